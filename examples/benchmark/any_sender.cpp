@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the cost of connecting and starting a type-erased `just()`, with the default
+// buffer sizes, with an allocator from the receiver's environment, and with buffers large
+// enough to hold the sender and the operation state inline.
+
+#include <exec/any_sender_of.hpp>
+#include <stdexec/execution.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#if __has_include(<memory_resource>)
+#  include <memory_resource> // IWYU pragma: keep
+#  define STDEXEC_HAS_MEMORY_RESOURCE 1
+#endif
+
+namespace {
+  using completions_t = stdexec::completion_signatures<stdexec::set_value_t(long)>;
+  using receiver_ref_t = exec::any_receiver_ref<completions_t>;
+
+  using default_sender = receiver_ref_t::any_sender<>;
+  using inline_sender = receiver_ref_t::basic_any_sender<128, 256>;
+
+  template <class Env>
+  struct sink_receiver {
+    using receiver_concept = stdexec::receiver_t;
+
+    void set_value(long value) noexcept {
+      *sum_ += value;
+    }
+
+    [[nodiscard]]
+    auto get_env() const noexcept -> Env {
+      return env_;
+    }
+
+    long* sum_;
+    Env env_;
+  };
+
+  // An upstream sender whose operation state is too large for the default buffer.
+  auto make_sender(long i) {
+    return stdexec::just(std::array<long, 8>{i})
+         | stdexec::then([](const std::array<long, 8>& a) noexcept { return a[0]; });
+  }
+
+  template <class Sender, class Env = stdexec::env<>>
+  auto run(std::string_view name, std::size_t iterations, Env env = {}) -> long {
+    long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      Sender sndr = make_sender(static_cast<long>(i));
+      auto op = stdexec::connect(std::move(sndr), sink_receiver<Env>{&sum, env});
+      stdexec::start(op);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << name << ": " << static_cast<double>(ns) / static_cast<double>(iterations)
+              << " ns/op\n";
+    return sum;
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t iterations = 10'000'000;
+  if (argc > 1) {
+    iterations = std::strtoul(argv[1], nullptr, 10);
+  }
+
+  long sum = 0;
+  sum += run<default_sender>("any_sender<>", iterations);
+#ifdef STDEXEC_HAS_MEMORY_RESOURCE
+  {
+    std::pmr::unsynchronized_pool_resource resource;
+    std::pmr::polymorphic_allocator<std::byte> alloc{&resource};
+    sum += run<default_sender>(
+      "any_sender<> with pooled allocator", iterations, stdexec::prop{stdexec::get_allocator, alloc});
+  }
+#endif
+  sum += run<inline_sender>("basic_any_sender<128, 256>", iterations);
+  std::cout << "checksum: " << sum << "\n";
+}
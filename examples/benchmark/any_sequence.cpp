@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the per-item cost of streaming integers through a sequence, with the concrete
+// sequence type, through any_sequence_receiver_ref::any_sender<> with the default buffer
+// sizes, and through a basic_any_sender whose buffers hold every item inline.
+
+#include <exec/sequence/any_sequence_of.hpp>
+#include <exec/sequence/ignore_all_values.hpp>
+#include <exec/sequence/iterate.hpp>
+#include <exec/sequence/transform_each.hpp>
+#include <stdexec/execution.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <ranges>
+#include <string_view>
+
+namespace {
+  using completions_t = stdexec::completion_signatures<
+    stdexec::set_value_t(long),
+    stdexec::set_error_t(std::exception_ptr),
+    stdexec::set_stopped_t()
+  >;
+  using receiver_ref_t = exec::any_sequence_receiver_ref<completions_t>;
+
+  using default_sequence = receiver_ref_t::any_sender<>;
+  using inline_sequence = receiver_ref_t::basic_any_sender<64, 256>;
+
+  auto make_sequence(long count) {
+    return exec::iterate(std::views::iota(0L, count));
+  }
+
+  template <class Sequence>
+  auto run(std::string_view name, long count) -> long {
+    long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    Sequence sequence = make_sequence(count);
+    stdexec::sync_wait(exec::ignore_all_values(
+      static_cast<Sequence&&>(sequence)
+      | exec::transform_each(stdexec::then([&sum](long value) noexcept { sum += value; }))));
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << name << ": " << static_cast<double>(ns) / static_cast<double>(count)
+              << " ns/item\n";
+    return sum;
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  long count = 10'000'000;
+  if (argc > 1) {
+    count = std::strtol(argv[1], nullptr, 10);
+  }
+
+  long sum = 0;
+  sum += run<decltype(make_sequence(count))>("concrete sequence", count);
+  sum += run<default_sequence>("any_sender<>", count);
+  sum += run<inline_sequence>("basic_any_sender<64, 256>", count);
+  std::cout << "checksum: " << sum << "\n";
+}
@@ -95,6 +95,40 @@ auto compute_perf(
   return all;
 }
 
+struct percentiles {
+  std::size_t samples;
+  double mean;
+  double min;
+  double p50;
+  double p90;
+  double p99;
+  double max;
+};
+
+// Nearest-rank percentiles over a set of samples. The samples are sorted in place.
+auto compute_percentiles(std::vector<double>& samples) -> percentiles {
+  if (samples.empty()) {
+    return {};
+  }
+  std::ranges::sort(samples);
+  auto rank = [&](double p) {
+    auto idx = static_cast<std::size_t>(std::ceil(p * static_cast<double>(samples.size())));
+    return samples[(std::max) (idx, std::size_t{1}) - 1];
+  };
+  double sum = 0.0;
+  for (double s: samples) {
+    sum += s;
+  }
+  return {
+    .samples = samples.size(),
+    .mean = sum / static_cast<double>(samples.size()),
+    .min = samples.front(),
+    .p50 = rank(0.50),
+    .p90 = rank(0.90),
+    .p99 = rank(0.99),
+    .max = samples.back()};
+}
+
 struct numa_deleter {
   std::size_t size_;
   exec::numa_allocator<char> allocator_;
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs the same workload matrix on every scheduler that is available in this
+// build and prints the results as JSON:
+//
+//   example.benchmark.compare [--threads N] [--runs N]
+//                             [--schedulers a,b,...] [--workloads a,b,...]
+//
+// Each workload is run `--runs` times after one warmup run. Percentiles are
+// taken over the per-run wall-clock times, except for `ping_pong`, where they
+// are taken over the individual round trips.
+
+#include "./common.hpp"
+
+#include <exec/any_sender_of.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <exec/system_context.hpp>
+#include <stdexec/execution.hpp>
+
+#if defined(STDEXEC_ENABLE_TBB)
+#  include <execpools/tbb/tbb_thread_pool.hpp>
+#endif
+#if defined(STDEXEC_ENABLE_TASKFLOW)
+#  include <execpools/taskflow/taskflow_thread_pool.hpp>
+#endif
+#if defined(STDEXEC_ASIO_USES_BOOST) || defined(STDEXEC_ASIO_USES_STANDALONE)
+#  define STDEXEC_BENCHMARK_ASIO 1
+#  include <execpools/asio/asio_thread_pool.hpp>
+#endif
+#if defined(STDEXEC_ENABLE_LIBDISPATCH) && __has_include(<dispatch/dispatch.h>)
+#  define STDEXEC_BENCHMARK_LIBDISPATCH 1
+#  include <exec/libdispatch_queue.hpp>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace {
+  struct options {
+    std::size_t threads = std::thread::hardware_concurrency();
+    std::size_t runs = 20;
+    std::vector<std::string> schedulers;
+    std::vector<std::string> workloads;
+
+    [[nodiscard]]
+    auto wants(const std::vector<std::string>& selected, std::string_view name) const -> bool {
+      return selected.empty() || std::ranges::find(selected, name) != selected.end();
+    }
+  };
+
+  auto split_list(std::string_view list) -> std::vector<std::string> {
+    std::vector<std::string> result;
+    while (!list.empty()) {
+      auto comma = list.find(',');
+      result.emplace_back(list.substr(0, comma));
+      list.remove_prefix(comma == std::string_view::npos ? list.size() : comma + 1);
+    }
+    return result;
+  }
+
+  // Some busy work that the optimizer cannot remove.
+  std::atomic<std::uint64_t> sink{0};
+
+  void spin(std::size_t iterations) noexcept {
+    std::uint64_t x = iterations;
+    for (std::size_t i = 0; i < iterations; ++i) {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    sink.fetch_add(x, std::memory_order_relaxed);
+  }
+
+  // Counts down outstanding operations and lets the caller block until all of
+  // them have finished.
+  struct countdown {
+    explicit countdown(std::size_t count)
+      : remaining_(count) {
+    }
+
+    void arrive() noexcept {
+      if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        remaining_.notify_all();
+      }
+    }
+
+    void wait() noexcept {
+      for (auto n = remaining_.load(std::memory_order_acquire); n != 0;
+           n = remaining_.load(std::memory_order_acquire)) {
+        remaining_.wait(n, std::memory_order_acquire);
+      }
+    }
+
+    std::atomic<std::size_t> remaining_;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Workloads. Each one performs a single run and returns the number of
+  // operations that the run stands for.
+
+  // Independent `schedule` operations submitted from the calling thread.
+  template <class Scheduler>
+  auto schedule_throughput(Scheduler sched) -> std::size_t {
+    constexpr std::size_t count = 100'000;
+    countdown done{count};
+    for (std::size_t i = 0; i < count; ++i) {
+      stdexec::start_detached(stdexec::schedule(sched) | stdexec::then([&] { done.arrive(); }));
+    }
+    done.wait();
+    return count;
+  }
+
+  // A fixed-width fork followed by a join, repeated.
+  template <class Scheduler, std::size_t... Is>
+  auto fan_out_fan_in_once(Scheduler sched, std::index_sequence<Is...>) {
+    auto branch = [&](std::size_t) {
+      return stdexec::schedule(sched) | stdexec::then([] { spin(256); });
+    };
+    stdexec::sync_wait(stdexec::when_all(branch(Is)...));
+    return sizeof...(Is);
+  }
+
+  template <class Scheduler>
+  auto fan_out_fan_in(Scheduler sched) -> std::size_t {
+    constexpr std::size_t rounds = 1'000;
+    std::size_t ops = 0;
+    for (std::size_t i = 0; i < rounds; ++i) {
+      ops += fan_out_fan_in_once(sched, std::make_index_sequence<16>{});
+    }
+    return ops;
+  }
+
+  // Every item of an outer bulk launches an inner bulk on the same scheduler.
+  template <class Scheduler>
+  auto nested_bulk(Scheduler sched) -> std::size_t {
+    constexpr std::size_t outer = 64;
+    constexpr std::size_t inner = 1'024;
+    countdown done{outer};
+    stdexec::sync_wait(
+      stdexec::schedule(sched) | stdexec::bulk(stdexec::par, outer, [&](std::size_t) {
+        stdexec::start_detached(
+          stdexec::schedule(sched)
+          | stdexec::bulk(stdexec::par, inner, [](std::size_t) { spin(64); })
+          | stdexec::then([&] { done.arrive(); }));
+      }));
+    done.wait();
+    return outer * inner;
+  }
+
+  // A bulk whose item cost grows linearly with its index, so that an even
+  // static partition leaves the last agent with most of the work.
+  template <class Scheduler>
+  auto imbalanced_bulk(Scheduler sched) -> std::size_t {
+    constexpr std::size_t size = 16'384;
+    stdexec::sync_wait(
+      stdexec::schedule(sched)
+      | stdexec::bulk(stdexec::par, size, [](std::size_t i) { spin(i / 16); }));
+    return size;
+  }
+
+  template <class... Ts>
+  using any_sender_of =
+    exec::any_receiver_ref<stdexec::completion_signatures<Ts...>>::template any_sender<>;
+
+  using fib_sender = any_sender_of<
+    stdexec::set_value_t(long),
+    stdexec::set_error_t(std::exception_ptr),
+    stdexec::set_stopped_t()>;
+
+  auto serial_fib(long n) -> long {
+    return n < 2 ? n : serial_fib(n - 1) + serial_fib(n - 2);
+  }
+
+  template <class Scheduler>
+  auto parallel_fib(Scheduler sched, long cutoff, long n) -> fib_sender {
+    if (n < cutoff) {
+      return fib_sender(stdexec::just(serial_fib(n)));
+    }
+    auto child = [=](long m) {
+      return stdexec::starts_on(sched, stdexec::just() | stdexec::let_value([=] {
+                                         return parallel_fib(sched, cutoff, m);
+                                       }));
+    };
+    return fib_sender(
+      stdexec::when_all(child(n - 1), child(n - 2)) | stdexec::then(std::plus<long>{}));
+  }
+
+  // Recursive fork/join.
+  template <class Scheduler>
+  auto fibonacci(Scheduler sched) -> std::size_t {
+    constexpr long cutoff = 16;
+    constexpr long n = 30;
+    auto [result] = stdexec::sync_wait(parallel_fib(sched, cutoff, n)).value();
+    if (result != serial_fib(n)) {
+      std::cerr << "fibonacci: wrong result " << result << "\n";
+      std::abort();
+    }
+    return 1;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // JSON output
+
+  struct json_writer {
+    explicit json_writer(const options& opts) {
+      std::cout << "{\n  \"threads\": " << opts.threads << ",\n  \"runs\": " << opts.runs
+                << ",\n  \"results\": [";
+    }
+
+    json_writer(json_writer&&) = delete;
+
+    ~json_writer() {
+      std::cout << "\n  ]\n}\n";
+    }
+
+    void record(
+      std::string_view scheduler,
+      std::string_view workload,
+      std::size_t ops_per_sample,
+      percentiles stats) {
+      std::cout << (first_ ? "\n" : ",\n") << std::fixed << std::setprecision(1)
+                << "    {\"scheduler\": \"" << scheduler << "\", \"workload\": \"" << workload
+                << "\", \"unit\": \"ns\", \"samples\": " << stats.samples
+                << ", \"ops_per_sample\": " << ops_per_sample << ", \"mean\": " << stats.mean
+                << ", \"min\": " << stats.min << ", \"p50\": " << stats.p50
+                << ", \"p90\": " << stats.p90 << ", \"p99\": " << stats.p99
+                << ", \"max\": " << stats.max << ", \"ops_per_sec\": "
+                << (stats.p50 > 0.0 ? static_cast<double>(ops_per_sample) * 1e9 / stats.p50 : 0.0)
+                << "}" << std::flush;
+      first_ = false;
+    }
+
+   private:
+    bool first_ = true;
+  };
+
+  auto elapsed_ns(std::chrono::steady_clock::time_point start) -> double {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+      .count();
+  }
+
+  template <class Workload>
+  auto measure_runs(const options& opts, Workload workload) -> std::pair<std::size_t, percentiles> {
+    static constexpr std::size_t warmup = 1;
+    std::vector<double> samples;
+    std::size_t ops = 0;
+    for (std::size_t i = 0; i < warmup + opts.runs; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      ops = workload();
+      auto ns = elapsed_ns(start);
+      if (i >= warmup) {
+        samples.push_back(ns);
+      }
+    }
+    return {ops, compute_percentiles(samples)};
+  }
+
+  // Round trips from the calling thread to the scheduler and back.
+  template <class Scheduler>
+  auto ping_pong(const options& opts, Scheduler sched) -> percentiles {
+    constexpr std::size_t round_trips = 1'000;
+    std::vector<double> samples;
+    samples.reserve(opts.runs * round_trips);
+    stdexec::sync_wait(stdexec::schedule(sched));
+    for (std::size_t i = 0; i < opts.runs * round_trips; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      stdexec::sync_wait(stdexec::schedule(sched));
+      samples.push_back(elapsed_ns(start));
+    }
+    return compute_percentiles(samples);
+  }
+
+  template <class Scheduler>
+  void run_matrix(std::string_view name, Scheduler sched, const options& opts, json_writer& out) {
+    auto run = [&](std::string_view workload, auto fn) {
+      if (opts.wants(opts.workloads, workload)) {
+        auto [ops, stats] = measure_runs(opts, [&] { return fn(sched); });
+        out.record(name, workload, ops, stats);
+      }
+    };
+    run("schedule", [](auto s) { return schedule_throughput(s); });
+    run("fan_out_fan_in", [](auto s) { return fan_out_fan_in(s); });
+    run("nested_bulk", [](auto s) { return nested_bulk(s); });
+    run("imbalanced_bulk", [](auto s) { return imbalanced_bulk(s); });
+    run("fibonacci", [](auto s) { return fibonacci(s); });
+    if (opts.wants(opts.workloads, "ping_pong")) {
+      out.record(name, "ping_pong", 1, ping_pong(opts, sched));
+    }
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string_view arg = argv[i];
+    if (arg == "--threads") {
+      opts.threads = std::strtoul(argv[i + 1], nullptr, 10);
+    } else if (arg == "--runs") {
+      opts.runs = std::strtoul(argv[i + 1], nullptr, 10);
+    } else if (arg == "--schedulers") {
+      opts.schedulers = split_list(argv[i + 1]);
+    } else if (arg == "--workloads") {
+      opts.workloads = split_list(argv[i + 1]);
+    } else {
+      std::cerr << "Usage: example.benchmark.compare [--threads N] [--runs N]"
+                   " [--schedulers a,b,...] [--workloads a,b,...]\n";
+      return -1;
+    }
+  }
+  opts.threads = (std::max) (opts.threads, std::size_t{1});
+  opts.runs = (std::max) (opts.runs, std::size_t{1});
+  auto nthreads = static_cast<int>(opts.threads);
+
+  json_writer out{opts};
+
+  if (opts.wants(opts.schedulers, "static_thread_pool")) {
+    exec::static_thread_pool pool{
+      static_cast<std::uint32_t>(nthreads), exec::bwos_params{}, exec::get_numa_policy()};
+    run_matrix("static_thread_pool", pool.get_scheduler(), opts, out);
+  }
+
+  // The parallel scheduler is sized by its backend, not by --threads.
+  if (opts.wants(opts.schedulers, "parallel_scheduler")) {
+    run_matrix("parallel_scheduler", exec::get_parallel_scheduler(), opts, out);
+  }
+
+#if defined(STDEXEC_ENABLE_TBB)
+  if (opts.wants(opts.schedulers, "tbb")) {
+    execpools::tbb_thread_pool pool{nthreads};
+    run_matrix("tbb", pool.get_scheduler(), opts, out);
+  }
+#endif
+
+#if defined(STDEXEC_ENABLE_TASKFLOW)
+  if (opts.wants(opts.schedulers, "taskflow")) {
+    execpools::taskflow_thread_pool pool{static_cast<std::size_t>(nthreads)};
+    run_matrix("taskflow", pool.get_scheduler(), opts, out);
+  }
+#endif
+
+#if defined(STDEXEC_BENCHMARK_ASIO)
+  if (opts.wants(opts.schedulers, "asio")) {
+    execpools::asio_thread_pool pool{static_cast<std::uint32_t>(nthreads)};
+    run_matrix("asio", pool.get_scheduler(), opts, out);
+  }
+#endif
+
+#if defined(STDEXEC_BENCHMARK_LIBDISPATCH)
+  // libdispatch uses the process-wide global queue and ignores --threads.
+  if (opts.wants(opts.schedulers, "libdispatch")) {
+    exec::libdispatch_queue queue;
+    run_matrix("libdispatch", queue.get_scheduler(), opts, out);
+  }
+#endif
+}
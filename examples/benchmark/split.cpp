@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the cost of attaching waiters to a split sender from several threads at once,
+// which is where the waiter list of the shared state is contended, and of notifying them
+// once the shared operation completes.
+
+#include <stdexec/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+  using std::chrono::steady_clock;
+
+  auto ns_per(steady_clock::duration elapsed, long count) -> double {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return static_cast<double>(ns) / static_cast<double>(count);
+  }
+
+  void run(unsigned threads, long waiters_per_thread) {
+    stdexec::run_loop loop;
+    // The shared operation cannot complete before the loop runs, so every waiter is pushed
+    // onto the waiter list.
+    auto shared = stdexec::split(stdexec::schedule(loop.get_scheduler()));
+    std::atomic<long> notified{0};
+
+    auto start = steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([&] {
+        for (long i = 0; i < waiters_per_thread; ++i) {
+          stdexec::start_detached(shared | stdexec::then([&]() noexcept {
+                                    notified.fetch_add(1, std::memory_order_relaxed);
+                                  }));
+        }
+      });
+    }
+    for (auto& worker: workers) {
+      worker.join();
+    }
+    auto attached = steady_clock::now();
+
+    loop.finish();
+    loop.run();
+    auto end = steady_clock::now();
+
+    const long total = waiters_per_thread * threads;
+    std::cout << threads << " threads: attach " << ns_per(attached - start, total)
+              << " ns/waiter, notify " << ns_per(end - attached, total) << " ns/waiter ("
+              << notified.load() << " notified)\n";
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  long waiters = 100'000;
+  if (argc > 1) {
+    waiters = std::strtol(argv[1], nullptr, 10);
+  }
+
+  unsigned max_threads = std::max(std::thread::hardware_concurrency(), 4u);
+  if (argc > 2) {
+    max_threads = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+  }
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    run(threads, waiters);
+  }
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+#include "../../stdexec/__detail/__memory.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Allocation of coroutine frames.
+//
+// A coroutine frame is allocated with the allocator passed to the coroutine as
+// `std::allocator_arg, alloc` (after the object parameter of a member coroutine), and
+// from a per-thread pool of recycled frames otherwise. Either way, a pointer to the
+// deallocation function is stored after the frame, so that the promise's sized
+// `operator delete` can find its way back.
+namespace exec::__frame {
+  // The unit of allocation for frames allocated with a user-provided allocator. Coroutine
+  // frames never need more than the default `operator new` alignment.
+  struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __block {
+    std::byte __data_[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+  };
+
+  using __dealloc_fn_t = void(void*, std::size_t) noexcept;
+
+  constexpr auto __align_up(std::size_t __n, std::size_t __align) noexcept -> std::size_t {
+    return (__n + __align - 1) & ~(__align - 1);
+  }
+
+  // The offset of the deallocation function pointer in an allocation for a frame of size
+  // __size.
+  constexpr auto __dealloc_fn_offset(std::size_t __size) noexcept -> std::size_t {
+    return __align_up(__size, alignof(__dealloc_fn_t*));
+  }
+
+  constexpr auto __header_end(std::size_t __size) noexcept -> std::size_t {
+    return __dealloc_fn_offset(__size) + sizeof(__dealloc_fn_t*);
+  }
+
+  inline void __set_dealloc_fn(void* __frame, std::size_t __size, __dealloc_fn_t* __fn) noexcept {
+    ::new (static_cast<std::byte*>(__frame) + __dealloc_fn_offset(__size)) __dealloc_fn_t*(__fn);
+  }
+
+  [[nodiscard]]
+  inline auto __get_dealloc_fn(void* __frame, std::size_t __size) noexcept -> __dealloc_fn_t* {
+    return *std::launder(reinterpret_cast<__dealloc_fn_t**>(
+      static_cast<std::byte*>(__frame) + __dealloc_fn_offset(__size)));
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////
+  // A per-thread cache of freed coroutine frames, bucketed by size. Short-lived coroutines
+  // that are created and destroyed on the same thread reuse each other's frames instead of
+  // going through the global heap every time. The default parallel scheduler backend also
+  // uses it for operation states that do not fit in their preallocated storage.
+  class __frame_pool {
+    static constexpr std::size_t __granularity = 64;
+    static constexpr std::size_t __bucket_count = 16; // frames up to 1 KiB are pooled
+    static constexpr std::size_t __max_cached = 16;   // per bucket
+
+    struct __free_frame {
+      __free_frame* __next_;
+    };
+
+    struct __bucket {
+      __free_frame* __head_{nullptr};
+      std::size_t __count_{0};
+    };
+
+    enum class __state : unsigned char {
+      __uninitialized,
+      __alive,
+      __destroyed
+    };
+
+    // Trivially destructible, so it can be read even after the pool has been destroyed
+    // during thread exit.
+    static auto __thread_state() noexcept -> __state& {
+      thread_local __state __s = __state::__uninitialized;
+      return __s;
+    }
+
+    static constexpr auto __bucket_index(std::size_t __size) noexcept -> std::size_t {
+      return (__size - 1) / __granularity;
+    }
+
+    // The size of the block that is allocated for __size bytes. Blocks of pooled sizes are
+    // rounded up to the size of their bucket, so that any bucket they are freed into can
+    // hand them out again.
+    static constexpr auto __block_size(std::size_t __size) noexcept -> std::size_t {
+      const std::size_t __index = __bucket_index(__size);
+      return __index < __bucket_count ? (__index + 1) * __granularity : __size;
+    }
+
+    __frame_pool() noexcept {
+      __thread_state() = __state::__alive;
+    }
+
+    ~__frame_pool() {
+      __thread_state() = __state::__destroyed;
+      for (__bucket& __b: __buckets_) {
+        while (__b.__head_ != nullptr) {
+          ::operator delete(std::exchange(__b.__head_, __b.__head_->__next_));
+        }
+      }
+    }
+
+    __bucket __buckets_[__bucket_count]{};
+
+   public:
+    __frame_pool(__frame_pool&&) = delete;
+
+    //! @return The calling thread's pool, or nullptr during thread exit.
+    [[nodiscard]]
+    static auto __get() noexcept -> __frame_pool* {
+      if (__thread_state() == __state::__destroyed) {
+        return nullptr;
+      }
+      thread_local __frame_pool __pool;
+      return &__pool;
+    }
+
+    [[nodiscard]]
+    auto __allocate(std::size_t __size) -> void* {
+      const std::size_t __index = __bucket_index(__size);
+      if (__index >= __bucket_count || __buckets_[__index].__head_ == nullptr) {
+        return ::operator new(__block_size(__size));
+      }
+      __bucket& __b = __buckets_[__index];
+      --__b.__count_;
+      return std::exchange(__b.__head_, __b.__head_->__next_);
+    }
+
+    //! Allocates __size bytes from the calling thread's pool. During thread exit, when the
+    //! pool is gone, the block comes from the global heap, but with the same rounded-up
+    //! size, because the thread that frees it may cache it in its own pool.
+    [[nodiscard]]
+    static auto __allocate_block(std::size_t __size) -> void* {
+      if (__frame_pool* __pool = __get()) {
+        return __pool->__allocate(__size);
+      }
+      return ::operator new(__block_size(__size));
+    }
+
+    //! Frees a block that __allocate_block returned for __size bytes, on any thread.
+    static void __deallocate_block(void* __ptr, std::size_t __size) noexcept {
+      if (__frame_pool* __pool = __get()) {
+        __pool->__deallocate(__ptr, __size);
+      } else {
+        ::operator delete(__ptr);
+      }
+    }
+
+    //! @return The number of freed frames that the pool holds for reuse.
+    [[nodiscard]]
+    auto __cached() const noexcept -> std::size_t {
+      std::size_t __n = 0;
+      for (const __bucket& __b: __buckets_) {
+        __n += __b.__count_;
+      }
+      return __n;
+    }
+
+    void __deallocate(void* __ptr, std::size_t __size) noexcept {
+      const std::size_t __index = __bucket_index(__size);
+      if (__index >= __bucket_count || __buckets_[__index].__count_ == __max_cached) {
+        ::operator delete(__ptr);
+        return;
+      }
+      __bucket& __b = __buckets_[__index];
+      __b.__head_ = ::new (__ptr) __free_frame{__b.__head_};
+      ++__b.__count_;
+    }
+  };
+
+  [[nodiscard]]
+  inline auto __allocate_pooled(std::size_t __size) -> void* {
+    void* __frame = __frame_pool::__allocate_block(__header_end(__size));
+    __set_dealloc_fn(__frame, __size, +[](void* __frame, std::size_t __size) noexcept {
+      __frame_pool::__deallocate_block(__frame, __header_end(__size));
+    });
+    return __frame;
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////
+  // Frames allocated with a user-provided allocator keep a copy of the allocator after the
+  // deallocation function pointer.
+  template <class _Alloc>
+  struct __with_allocator {
+    using __alloc_t = std::allocator_traits<_Alloc>::template rebind_alloc<__block>;
+    using __traits_t = std::allocator_traits<__alloc_t>;
+    static_assert(alignof(__alloc_t) <= alignof(__block));
+
+    static constexpr auto __alloc_offset(std::size_t __size) noexcept -> std::size_t {
+      return __align_up(__header_end(__size), alignof(__alloc_t));
+    }
+
+    static constexpr auto __block_count(std::size_t __size) noexcept -> std::size_t {
+      return (__alloc_offset(__size) + sizeof(__alloc_t) + sizeof(__block) - 1) / sizeof(__block);
+    }
+
+    [[nodiscard]]
+    static auto __allocate(std::size_t __size, const _Alloc& __alloc) -> void* {
+      __alloc_t __block_alloc = STDEXEC::__rebind_allocator<__block>(__alloc);
+      void* __frame = __traits_t::allocate(__block_alloc, __block_count(__size));
+      ::new (static_cast<std::byte*>(__frame) + __alloc_offset(__size))
+        __alloc_t(std::move(__block_alloc));
+      __set_dealloc_fn(__frame, __size, &__deallocate);
+      return __frame;
+    }
+
+    static void __deallocate(void* __frame, std::size_t __size) noexcept {
+      auto* __stored = std::launder(
+        reinterpret_cast<__alloc_t*>(static_cast<std::byte*>(__frame) + __alloc_offset(__size)));
+      __alloc_t __block_alloc = std::move(*__stored);
+      __stored->~__alloc_t();
+      __traits_t::deallocate(__block_alloc, static_cast<__block*>(__frame), __block_count(__size));
+    }
+  };
+
+  ////////////////////////////////////////////////////////////////////////////////
+  //! A base class for coroutine promise types that provides the frame allocation
+  //! `operator new` and `operator delete` overloads.
+  //!
+  //! A frame is always freed through the sized `operator delete`, which finds the
+  //! deallocation function that the `operator new` overload stored. GCC 12 never considers
+  //! a non-template `operator delete` a match for an `operator new` template, and warns
+  //! with -Wmismatched-new-delete where a coroutine that takes an allocator argument is
+  //! defined. The templates are always inlined, so that the frame comes from
+  //! __with_allocator::__allocate as far as the warning is concerned.
+  struct __with_frame_allocator {
+    [[nodiscard]]
+    static auto operator new(std::size_t __size) -> void* {
+      return __frame::__allocate_pooled(__size);
+    }
+
+    template <class _Alloc, class... _Args>
+    [[nodiscard]]
+    STDEXEC_ATTRIBUTE(always_inline)
+    static auto operator new(
+      std::size_t __size,
+      std::allocator_arg_t,
+      const _Alloc& __alloc,
+      const _Args&...) -> void* {
+      return __with_allocator<_Alloc>::__allocate(__size, __alloc);
+    }
+
+    // For member function coroutines, the object parameter comes first.
+    template <class _Self, class _Alloc, class... _Args>
+    [[nodiscard]]
+    STDEXEC_ATTRIBUTE(always_inline)
+    static auto operator new(
+      std::size_t __size,
+      const _Self&,
+      std::allocator_arg_t,
+      const _Alloc& __alloc,
+      const _Args&...) -> void* {
+      return __with_allocator<_Alloc>::__allocate(__size, __alloc);
+    }
+
+    static void operator delete(void* __frame, std::size_t __size) noexcept {
+      __frame::__get_dealloc_fn(__frame, __size)(__frame, __size);
+    }
+  };
+} // namespace exec::__frame
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <cstdint>
+
+// Scheduler tracing. When STDEXEC_ENABLE_TRACING is set, the schedulers in
+// exec:: record lightweight events into per-thread ring buffers, which
+// exec::trace::write_chrome_json (see exec/trace.hpp) dumps in the Chrome
+// trace event format. If <sys/sdt.h> is available, every event also fires a
+// USDT probe in the `stdexec` provider, for use with perf, bpftrace or
+// SystemTap. When STDEXEC_ENABLE_TRACING is not set, STDEXEC_TRACE expands
+// to nothing.
+#ifndef STDEXEC_ENABLE_TRACING
+#  define STDEXEC_ENABLE_TRACING 0
+#endif
+
+// Tracing changes the bodies of inline member functions of the schedulers.
+// When it is enabled, the classes that record events carry an ABI tag, so
+// that translation units built with and without tracing get distinct
+// symbols instead of sharing whichever definition the linker keeps. MSVC has
+// no ABI tags; it refuses to link such a mix instead.
+#if STDEXEC_ENABLE_TRACING && (STDEXEC_GCC() || STDEXEC_CLANG())
+#  define STDEXEC_TRACE_ABI_TAG [[gnu::abi_tag("stdexec_trace")]]
+#else
+#  define STDEXEC_TRACE_ABI_TAG
+#endif
+
+#if STDEXEC_MSVC()
+#  pragma detect_mismatch("stdexec_trace", STDEXEC_PP_STRINGIZE(STDEXEC_ENABLE_TRACING))
+#endif
+
+// The number of events each thread keeps before the oldest are overwritten.
+// A ring of events takes 24 bytes per event, 96 KiB by default.
+#ifndef STDEXEC_TRACE_BUFFER_SIZE
+#  define STDEXEC_TRACE_BUFFER_SIZE (1u << 12)
+#endif
+
+namespace exec::__trace {
+  enum class __event : std::uint8_t {
+    enqueue,
+    dequeue,
+    steal,
+    park,
+    unpark,
+    io_submit,
+    io_complete
+  };
+
+  inline constexpr const char* __event_names[] =
+    {"enqueue", "dequeue", "steal", "park", "unpark", "io_submit", "io_complete"};
+} // namespace exec::__trace
+
+#if STDEXEC_ENABLE_TRACING
+
+#  include <atomic>
+#  include <chrono>
+#  include <memory>
+#  include <mutex>
+#  include <vector>
+
+#  if __has_include(<sys/sdt.h>)
+#    include <sys/sdt.h>
+#    define STDEXEC_TRACE_USDT(_EVENT, _ARG) STAP_PROBE1(stdexec, _EVENT, _ARG)
+#  else
+#    define STDEXEC_TRACE_USDT(_EVENT, _ARG) ((void) 0)
+#  endif
+
+namespace exec::__trace {
+  // The fields are atomics, written and read with relaxed ordering, so that
+  // write_chrome_json can read a ring while its owner keeps writing it.
+  struct __record {
+    std::atomic<std::uint64_t> __time_ns_;
+    std::atomic<std::uint64_t> __arg_;
+    std::atomic<__event> __kind_;
+  };
+
+  // A ring buffer with a single writer, the thread that owns it. A record is
+  // written after __head_ has moved past the record it overwrites, and a
+  // release fence orders the two, so a reader that loads __head_ again after
+  // an acquire fence knows which of the records it read may have been
+  // overwritten in the meantime (see __stable).
+  struct __ring {
+    explicit __ring(std::uint32_t __tid)
+      : __tid_(__tid) {
+    }
+
+    void __push(__event __kind, std::uint64_t __arg) noexcept {
+      auto __now = std::chrono::steady_clock::now().time_since_epoch();
+      std::uint64_t __pos = __head_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      auto& __rec = __records_[__pos % STDEXEC_TRACE_BUFFER_SIZE];
+      __rec.__time_ns_.store(
+        static_cast<std::uint64_t>(std::chrono::nanoseconds(__now).count()),
+        std::memory_order_relaxed);
+      __rec.__arg_.store(__arg, std::memory_order_relaxed);
+      __rec.__kind_.store(__kind, std::memory_order_relaxed);
+      __head_.store(__pos + 1, std::memory_order_release);
+    }
+
+    // Whether the record at position __pos, read before __head_ was loaded
+    // as __head, cannot have been overwritten while it was read. The owner
+    // may be writing position __head, which reuses the slot of
+    // __head - STDEXEC_TRACE_BUFFER_SIZE.
+    static constexpr auto __stable(std::uint64_t __pos, std::uint64_t __head) noexcept -> bool {
+      return __pos + STDEXEC_TRACE_BUFFER_SIZE > __head;
+    }
+
+    std::uint32_t __tid_;
+    std::atomic<std::uint64_t> __head_{0};
+    std::unique_ptr<__record[]> __records_{new __record[STDEXEC_TRACE_BUFFER_SIZE]};
+  };
+
+  // The registry owns the rings, so that the events of a thread can be
+  // dumped after it has exited. A thread hands its ring back when it exits,
+  // and the next thread that starts tracing continues it, so that there are
+  // only as many rings as threads that trace at the same time. Such threads
+  // share a tid in the trace.
+  struct __registry {
+    // Never destroyed, as threads may exit after static destruction began.
+    static auto __instance() -> __registry& {
+      static __registry* const __reg = new __registry;
+      return *__reg;
+    }
+
+    auto __acquire() -> __ring* {
+      std::scoped_lock __lock{__mutex_};
+      if (!__idle_.empty()) {
+        __ring* __r = __idle_.back();
+        __idle_.pop_back();
+        return __r;
+      }
+      __idle_.reserve(__rings_.size() + 1);
+      return __rings_
+        .emplace_back(std::make_unique<__ring>(static_cast<std::uint32_t>(__rings_.size() + 1)))
+        .get();
+    }
+
+    void __release(__ring* __r) noexcept {
+      std::scoped_lock __lock{__mutex_};
+      // Cannot allocate: __acquire has reserved room for every ring.
+      __idle_.push_back(__r);
+    }
+
+    std::mutex __mutex_;
+    std::vector<std::unique_ptr<__ring>> __rings_;
+    std::vector<__ring*> __idle_;
+  };
+
+  // The ring of a thread, from its first event until it exits.
+  struct __ring_lease {
+    __ring_lease()
+      : __ring_(__registry::__instance().__acquire()) {
+    }
+
+    __ring_lease(__ring_lease&&) = delete;
+
+    ~__ring_lease() {
+      __registry::__instance().__release(__ring_);
+    }
+
+    __ring* __ring_;
+  };
+
+  inline auto __this_thread_ring() -> __ring& {
+    thread_local __ring_lease __lease;
+    return *__lease.__ring_;
+  }
+
+  inline void __emit(__event __kind, std::uint64_t __arg) noexcept {
+    __this_thread_ring().__push(__kind, __arg);
+  }
+
+  template <class _Ty>
+  inline auto __as_arg(_Ty* __ptr) noexcept -> std::uint64_t {
+    return reinterpret_cast<std::uintptr_t>(__ptr);
+  }
+
+  template <class _Ty>
+  constexpr auto __as_arg(_Ty __value) noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(__value);
+  }
+} // namespace exec::__trace
+
+#  define STDEXEC_TRACE(_EVENT, _ARG)                                                              \
+    do {                                                                                           \
+      const std::uint64_t __stdexec_trace_arg = ::exec::__trace::__as_arg(_ARG);                   \
+      STDEXEC_TRACE_USDT(_EVENT, __stdexec_trace_arg);                                             \
+      ::exec::__trace::__emit(::exec::__trace::__event::_EVENT, __stdexec_trace_arg);              \
+    } while (false)
+
+#else
+
+#  define STDEXEC_TRACE(_EVENT, _ARG) ((void) 0)
+
+#endif
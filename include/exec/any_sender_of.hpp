@@ -259,11 +259,17 @@ namespace exec {
       {*__create_vtable(__mtype<_ParentVTable>{}, __mtype<_Tp>{})},
       {__storage_vfun_fn<_Storage, _Tp>{}(static_cast<_StorageCPOs*>(nullptr))}...};
 
+    //! The default size of the small-object buffer of a type-erased sender.
+    inline constexpr std::size_t __default_sender_inline_size = 3 * sizeof(void*);
+
+    //! The default size of the small-object buffer of a type-erased operation state.
+    inline constexpr std::size_t __default_operation_inline_size = 6 * sizeof(void*);
+
     template <
       class _Vtable,
       class _Allocator,
       bool _Copyable = false,
-      std::size_t _InlineSize = 3 * sizeof(void*),
+      std::size_t _InlineSize = __default_sender_inline_size,
       std::size_t _Alignment = alignof(std::max_align_t)
     >
     class __storage;
@@ -271,7 +277,7 @@ namespace exec {
     template <
       class _Vtable,
       class _Allocator,
-      std::size_t _InlineSize = 3 * sizeof(void*),
+      std::size_t _InlineSize = __default_sender_inline_size,
       std::size_t _Alignment = alignof(std::max_align_t)
     >
     struct __immovable_storage : __immovable {
@@ -314,6 +320,22 @@ namespace exec {
         }
       }
 
+      template <class _Tp, class... _Args>
+        requires __callable<__create_vtable_t, __mtype<_Vtable>, __mtype<_Tp>>
+      __immovable_storage(
+        std::allocator_arg_t,
+        const _Allocator& __alloc,
+        std::in_place_type_t<_Tp>,
+        _Args&&... __args)
+        : __vtable_{__get_vtable_of_type<_Tp>()}
+        , __allocator_{__alloc} {
+        if constexpr (__is_small<_Tp>) {
+          __construct_small<_Tp>(static_cast<_Args&&>(__args)...);
+        } else {
+          __construct_large<_Tp>(static_cast<_Args&&>(__args)...);
+        }
+      }
+
       ~__immovable_storage() {
         __reset();
       }
@@ -380,7 +402,7 @@ namespace exec {
      private:
       const __vtable_t* __vtable_{__default_storage_vtable(static_cast<__vtable_t*>(nullptr))};
       void* __object_pointer_{nullptr};
-      alignas(__alignment) std::byte __buffer_[__buffer_size]{};
+      alignas(__alignment) std::byte __buffer_[__buffer_size];
       STDEXEC_IMMOVABLE_NO_UNIQUE_ADDRESS
       _Allocator __allocator_{};
     };
@@ -581,7 +603,7 @@ namespace exec {
 
       const __vtable_t* __vtable_{__default_storage_vtable(static_cast<__vtable_t*>(nullptr))};
       void* __object_pointer_{nullptr};
-      alignas(__alignment) std::byte __buffer_[__buffer_size]{};
+      alignas(__alignment) std::byte __buffer_[__buffer_size];
       STDEXEC_ATTRIBUTE(no_unique_address) _Allocator __allocator_ { };
     };
 
@@ -596,21 +618,137 @@ namespace exec {
     template <
       class _VTable = __empty_vtable,
       class _Allocator = std::allocator<std::byte>,
-      std::size_t _InlineSize = 3 * sizeof(void*),
+      std::size_t _InlineSize = __default_sender_inline_size,
       std::size_t _Alignment = alignof(std::max_align_t)
     >
     using __immovable_storage_t = __immovable_storage<_VTable, _Allocator, _InlineSize, _Alignment>;
 
-    template <class _VTable, class _Allocator = std::allocator<std::byte>>
-    using __unique_storage_t = __storage<_VTable, _Allocator>;
+    template <
+      class _VTable,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      class _Allocator = std::allocator<std::byte>
+    >
+    using __unique_storage_t = __storage<_VTable, _Allocator, false, _InlineSize>;
 
     template <
       class _VTable,
-      std::size_t _InlineSize = 3 * sizeof(void*),
+      std::size_t _InlineSize = __default_sender_inline_size,
       class _Allocator = std::allocator<std::byte>
     >
     using __copyable_storage_t = __storage<_VTable, _Allocator, true, _InlineSize>;
 
+    // The unit of allocation for type-erased allocators. Allocating whole blocks keeps
+    // every allocation suitably aligned for any type that is not over-aligned.
+    struct alignas(std::max_align_t) __alloc_block {
+      std::byte __data_[alignof(std::max_align_t)];
+    };
+
+    struct __allocator_vtable {
+      void* (*__allocate_)(void*, std::size_t);
+      void (*__deallocate_)(void*, void*, std::size_t) noexcept;
+    };
+
+    template <class _Alloc>
+    inline constexpr __allocator_vtable __allocator_vtable_for{
+      [](void* __alloc, std::size_t __n) -> void* {
+        return std::allocator_traits<_Alloc>::allocate(*static_cast<_Alloc*>(__alloc), __n);
+      },
+      [](void* __alloc, void* __ptr, std::size_t __n) noexcept {
+        std::allocator_traits<_Alloc>::deallocate(
+          *static_cast<_Alloc*>(__alloc), static_cast<__alloc_block*>(__ptr), __n);
+      }};
+
+    //! A type-erased reference to an allocator of `__alloc_block`s. It is used to allocate
+    //! type-erased operation states with the allocator from the receiver's environment. A
+    //! default-constructed `__allocator_ref` uses `std::allocator`.
+    template <class _Ty>
+    class __allocator_ref {
+      template <class>
+      friend class __allocator_ref;
+
+      static constexpr bool __use_blocks = alignof(_Ty) <= alignof(__alloc_block);
+
+      static constexpr auto __block_count(std::size_t __n) noexcept -> std::size_t {
+        return (__n * sizeof(_Ty) + sizeof(__alloc_block) - 1) / sizeof(__alloc_block);
+      }
+
+     public:
+      using value_type = _Ty;
+
+      __allocator_ref() = default;
+
+      template <class _Alloc>
+        requires __same_as<typename std::allocator_traits<_Alloc>::value_type, __alloc_block>
+      explicit __allocator_ref(_Alloc& __alloc) noexcept
+        : __alloc_{&__alloc}
+        , __vtable_{&__allocator_vtable_for<_Alloc>} {
+      }
+
+      template <class _Uy>
+      __allocator_ref(const __allocator_ref<_Uy>& __other) noexcept
+        : __alloc_{__other.__alloc_}
+        , __vtable_{__other.__vtable_} {
+      }
+
+      [[nodiscard]]
+      auto allocate(std::size_t __n) -> _Ty* {
+        if constexpr (__use_blocks) {
+          if (__vtable_ != nullptr) {
+            return static_cast<_Ty*>(__vtable_->__allocate_(__alloc_, __block_count(__n)));
+          }
+        }
+        return std::allocator<_Ty>{}.allocate(__n);
+      }
+
+      void deallocate(_Ty* __ptr, std::size_t __n) noexcept {
+        if constexpr (__use_blocks) {
+          if (__vtable_ != nullptr) {
+            __vtable_->__deallocate_(__alloc_, __ptr, __block_count(__n));
+            return;
+          }
+        }
+        std::allocator<_Ty>{}.deallocate(__ptr, __n);
+      }
+
+      template <class _Uy>
+      auto operator==(const __allocator_ref<_Uy>& __other) const noexcept -> bool {
+        return __alloc_ == __other.__alloc_ && __vtable_ == __other.__vtable_;
+      }
+
+     private:
+      void* __alloc_{nullptr};
+      const __allocator_vtable* __vtable_{nullptr};
+    };
+
+    //! Holds the allocator from the receiver's environment, if it has one, for allocating
+    //! the type-erased operation state.
+    template <class _Receiver>
+    struct __operation_allocator {
+      explicit __operation_allocator(const _Receiver&) noexcept {
+      }
+
+      auto __get() noexcept -> __allocator_ref<std::byte> {
+        return {};
+      }
+    };
+
+    template <class _Receiver>
+      requires __callable<get_allocator_t, env_of_t<const _Receiver&>>
+    struct __operation_allocator<_Receiver> {
+      explicit __operation_allocator(const _Receiver& __rcvr) noexcept
+        : __alloc_{STDEXEC::__rebind_allocator<__alloc_block>(
+            get_allocator(STDEXEC::get_env(__rcvr)))} {
+      }
+
+      auto __get() noexcept -> __allocator_ref<std::byte> {
+        return __allocator_ref<std::byte>{__alloc_};
+      }
+
+      using __allocator_t = decltype(STDEXEC::__rebind_allocator<__alloc_block>(
+        get_allocator(STDEXEC::get_env(__declval<const _Receiver&>()))));
+      __allocator_t __alloc_;
+    };
+
     template <class _Tag, class... _As>
     auto __tag_type(_Tag (*)(_As...)) -> _Tag;
 
@@ -654,6 +792,17 @@ namespace exec {
       !__is_stop_token_query<_Query> || __is_never_stop_token_query<_Query>
       || (__satisfies_receiver_stop_token_query<_Query, _Env> || ...);
 
+    // The stop token that the erased receiver reports. Receivers with a never_stop_token
+    // report a token that is never stopped.
+    template <class _Env>
+    auto __inplace_stop_token_of(const _Env& __env) noexcept -> inplace_stop_token {
+      if constexpr (__same_as<stop_token_of_t<_Env>, never_stop_token>) {
+        return inplace_stop_token{};
+      } else {
+        return STDEXEC::get_stop_token(__env);
+      }
+    }
+
     namespace __rec {
       template <class _Sigs, class... _Queries>
       struct __vtable;
@@ -728,7 +877,7 @@ namespace exec {
           : __env_{
               __create_vtable(__mtype<__vtable_t>{}, __mtype<_Rcvr>{}),
               &__rcvr,
-              STDEXEC::get_stop_token(STDEXEC::get_env(__rcvr))} {
+              __any::__inplace_stop_token_of(STDEXEC::get_env(__rcvr))} {
         }
 
         template <class... _As>
@@ -843,8 +992,11 @@ namespace exec {
       void (*__start_)(void*) noexcept;
     };
 
-    using __immovable_operation_storage =
-      __immovable_storage_t<__operation_vtable, std::allocator<std::byte>, 6 * sizeof(void*)>;
+    template <std::size_t _InlineSize = __default_operation_inline_size>
+    using __immovable_operation_storage_t =
+      __immovable_storage_t<__operation_vtable, __allocator_ref<std::byte>, _InlineSize>;
+
+    using __immovable_operation_storage = __immovable_operation_storage_t<>;
 
     template <class _Sigs, class _Queries>
     using __receiver_ref = __mapply<__mbind_front_q<__rec::__ref, _Sigs>, _Queries>;
@@ -905,14 +1057,15 @@ namespace exec {
       __operation_base<_Receiver>* __op_;
     };
 
-    template <class _Receiver, bool>
+    template <class _Receiver, bool, std::size_t _OpInlineSize = __default_operation_inline_size>
     struct __operation : __operation_base<_Receiver> {
      public:
       template <class _Sender>
       explicit __operation(_Sender&& __sender, _Receiver&& __receiver)
         : __operation_base<_Receiver>{static_cast<_Receiver&&>(__receiver)}
         , __rec_{this}
-        , __storage_{__sender.__connect(__rec_)} {
+        , __alloc_{this->__rcvr_}
+        , __storage_{__sender.__connect(__rec_, __alloc_.__get())} {
       }
 
       void start() & noexcept {
@@ -925,16 +1078,18 @@ namespace exec {
 
      private:
       __stoppable_receiver<_Receiver> __rec_;
-      __immovable_operation_storage __storage_{};
+      __operation_allocator<_Receiver> __alloc_;
+      __immovable_operation_storage_t<_OpInlineSize> __storage_{};
     };
 
-    template <class _Receiver>
-    struct __operation<_Receiver, false> {
+    template <class _Receiver, std::size_t _OpInlineSize>
+    struct __operation<_Receiver, false, _OpInlineSize> {
      public:
       template <class _Sender>
       explicit __operation(_Sender&& __sender, _Receiver&& __receiver)
         : __rec_{static_cast<_Receiver&&>(__receiver)}
-        , __storage_{__sender.__connect(__rec_)} {
+        , __alloc_{__rec_}
+        , __storage_{__sender.__connect(__rec_, __alloc_.__get())} {
       }
 
       void start() & noexcept {
@@ -944,7 +1099,8 @@ namespace exec {
 
      private:
       STDEXEC_ATTRIBUTE(no_unique_address) _Receiver __rec_;
-      __immovable_operation_storage __storage_{};
+      STDEXEC_ATTRIBUTE(no_unique_address) __operation_allocator<_Receiver> __alloc_;
+      __immovable_operation_storage_t<_OpInlineSize> __storage_{};
     };
 
     template <class _Queries, bool _IsEnvProvider = true>
@@ -964,11 +1120,18 @@ namespace exec {
       }
     };
 
-    template <class _Sigs, class _SenderQueries = __mlist<>, class _ReceiverQueries = __mlist<>>
+    template <
+      class _Sigs,
+      class _SenderQueries = __mlist<>,
+      class _ReceiverQueries = __mlist<>,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      std::size_t _OpInlineSize = __default_operation_inline_size
+    >
     struct __sender {
       using sender_concept = STDEXEC::sender_t;
       using completion_signatures = _Sigs;
       using __receiver_ref_t = __receiver_ref<_Sigs, _ReceiverQueries>;
+      using __operation_storage_t = __immovable_operation_storage_t<_OpInlineSize>;
 
       struct __vtable;
       struct __attrs;
@@ -976,6 +1139,15 @@ namespace exec {
       static constexpr bool __with_inplace_stop_token =
         __mapply<__mall_of<__q<__is_not_stop_token_query_t>>, _ReceiverQueries>::value;
 
+      // A receiver whose stop token is already an inplace_stop_token, or a
+      // never_stop_token, is handed to the erased operation directly, without a stop
+      // source and callback in between.
+      template <class _Receiver>
+      static constexpr bool __needs_stop_source =
+        __with_inplace_stop_token
+        && !__same_as<stop_token_of_t<env_of_t<_Receiver>>, inplace_stop_token>
+        && !__same_as<stop_token_of_t<env_of_t<_Receiver>>, never_stop_token>;
+
       __sender(__sender&&) = default;
       __sender(const __sender&) = delete;
 
@@ -988,9 +1160,10 @@ namespace exec {
         : __storage_{static_cast<_Sender&&>(__sndr)} {
       }
 
-      auto __connect(__receiver_ref_t __receiver) -> __immovable_operation_storage {
+      auto __connect(__receiver_ref_t __receiver, __allocator_ref<std::byte> __alloc)
+        -> __operation_storage_t {
         return __storage_.__get_vtable()->__connect_(
-          __storage_.__get_object_pointer(), static_cast<__receiver_ref_t&&>(__receiver));
+          __storage_.__get_object_pointer(), static_cast<__receiver_ref_t&&>(__receiver), __alloc);
       }
 
       auto get_env() const noexcept -> __attrs {
@@ -998,17 +1171,24 @@ namespace exec {
       }
 
       template <receiver_of<_Sigs> _Receiver>
-      auto connect(_Receiver __rcvr) && -> __operation<_Receiver, __with_inplace_stop_token> {
-        return __operation<_Receiver, __with_inplace_stop_token>{
+      auto connect(_Receiver __rcvr) && //
+        -> __operation<_Receiver, __needs_stop_source<_Receiver>, _OpInlineSize> {
+        return __operation<_Receiver, __needs_stop_source<_Receiver>, _OpInlineSize>{
           static_cast<__sender&&>(*this), static_cast<_Receiver&&>(__rcvr)};
       }
 
      private:
-      __unique_storage_t<__vtable> __storage_;
+      __unique_storage_t<__vtable, _InlineSize> __storage_;
     };
 
-    template <class _Sigs, class _SenderQueries, class _ReceiverQueries>
-    struct __sender<_Sigs, _SenderQueries, _ReceiverQueries>::__vtable
+    template <
+      class _Sigs,
+      class _SenderQueries,
+      class _ReceiverQueries,
+      std::size_t _InlineSize,
+      std::size_t _OpInlineSize
+    >
+    struct __sender<_Sigs, _SenderQueries, _ReceiverQueries, _InlineSize, _OpInlineSize>::__vtable
       : __query_vtable<_SenderQueries> {
       auto __queries() const noexcept -> const __query_vtable<_SenderQueries>& {
         return *this;
@@ -1018,11 +1198,13 @@ namespace exec {
       static auto __create_vtable(__mtype<_Sender>) noexcept -> const __vtable* {
         static const __vtable __vtable_{
           {*__any::__create_vtable(__mtype<__query_vtable<_SenderQueries>>{}, __mtype<_Sender>{})},
-          [](void* __object_pointer, __receiver_ref_t __receiver) -> __immovable_operation_storage {
+          [](void* __object_pointer,
+             __receiver_ref_t __receiver,
+             __allocator_ref<std::byte> __alloc) -> __operation_storage_t {
             _Sender& __sender = *static_cast<_Sender*>(__object_pointer);
             using __op_state_t = connect_result_t<_Sender, __receiver_ref_t>;
-            return __immovable_operation_storage{
-              std::in_place_type<__op_state_t>, __emplace_from{[&] {
+            return __operation_storage_t{
+              std::allocator_arg, __alloc, std::in_place_type<__op_state_t>, __emplace_from{[&] {
                 return STDEXEC::connect(
                   static_cast<_Sender&&>(__sender), static_cast<__receiver_ref_t&&>(__receiver));
               }}};
@@ -1030,11 +1212,17 @@ namespace exec {
         return &__vtable_;
       }
 
-      __immovable_operation_storage (*__connect_)(void*, __receiver_ref_t);
+      __operation_storage_t (*__connect_)(void*, __receiver_ref_t, __allocator_ref<std::byte>);
     };
 
-    template <class _Sigs, class _SenderQueries, class _ReceiverQueries>
-    struct __sender<_Sigs, _SenderQueries, _ReceiverQueries>::__attrs {
+    template <
+      class _Sigs,
+      class _SenderQueries,
+      class _ReceiverQueries,
+      std::size_t _InlineSize,
+      std::size_t _OpInlineSize
+    >
+    struct __sender<_Sigs, _SenderQueries, _ReceiverQueries, _InlineSize, _OpInlineSize>::__attrs {
       template <class _Tag, class... _As>
         requires __callable<const __query_vtable<_SenderQueries>&, _Tag, void*, _As...>
       auto query(_Tag, _As&&... __as) const
@@ -1188,22 +1376,32 @@ namespace exec {
       return STDEXEC::get_env(__rcvr_);
     }
 
-    template <auto... _SenderQueries>
-    class any_sender {
-      using __base_t =
-        __any::__sender<_Completions, queries<_SenderQueries...>, queries<_ReceiverQueries...>>;
+    //! A type-erased sender whose small-object buffers have caller-chosen sizes.
+    //! `_InlineSize` bytes are reserved for the erased sender and `_OpInlineSize` bytes for
+    //! the erased operation state. Objects that do not fit are allocated on the heap; the
+    //! operation state is allocated with the receiver's allocator when its environment has
+    //! one.
+    template <std::size_t _InlineSize, std::size_t _OpInlineSize, auto... _SenderQueries>
+    class basic_any_sender {
+      using __base_t = __any::__sender<
+        _Completions,
+        queries<_SenderQueries...>,
+        queries<_ReceiverQueries...>,
+        _InlineSize,
+        _OpInlineSize
+      >;
       __base_t __sender_;
 
      public:
       using sender_concept = STDEXEC::sender_t;
 
-      template <STDEXEC::__not_decays_to<any_sender> _Sender>
+      template <STDEXEC::__not_decays_to<basic_any_sender> _Sender>
         requires STDEXEC::sender_to<_Sender, __receiver_base>
-      any_sender(_Sender&& __sender)
+      basic_any_sender(_Sender&& __sender)
         : __sender_(static_cast<_Sender&&>(__sender)) {
       }
 
-      template <STDEXEC::__decays_to_derived_from<any_sender> _Self, class... _Env>
+      template <STDEXEC::__decays_to_derived_from<basic_any_sender> _Self, class... _Env>
         requires(__any::__satisfies_receiver_query<decltype(_ReceiverQueries), _Env...> && ...)
       static consteval auto get_completion_signatures() -> __base_t::completion_signatures {
         return {};
@@ -1311,5 +1509,12 @@ namespace exec {
         auto operator==(const any_scheduler&) const noexcept -> bool = default;
       };
     };
+
+    template <auto... _SenderQueries>
+    using any_sender = basic_any_sender<
+      __any::__default_sender_inline_size,
+      __any::__default_operation_inline_size,
+      _SenderQueries...
+    >;
   };
 } // namespace exec
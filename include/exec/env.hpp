@@ -219,6 +219,22 @@ namespace exec {
 
   inline constexpr __write_attrs::__write_attrs_t write_attrs{};
 
+  // A query for the number of execution agents that a scheduler can run at
+  // the same time, e.g. the number of threads of a thread pool. Algorithms
+  // that split their work between agents ask the scheduler for it, and fall
+  // back to std::thread::hardware_concurrency() if it cannot answer.
+  // NOT TO SPEC.
+  struct get_available_parallelism_t : STDEXEC::__query<get_available_parallelism_t> {
+    using STDEXEC::__query<get_available_parallelism_t>::operator();
+
+    STDEXEC_ATTRIBUTE(nodiscard, always_inline, host, device)
+    static consteval auto query(STDEXEC::forwarding_query_t) noexcept -> bool {
+      return true;
+    }
+  };
+
+  inline constexpr get_available_parallelism_t get_available_parallelism{};
+
 } // namespace exec
 
 STDEXEC_PRAGMA_POP()
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace exec {
+  // A lock-free histogram of latencies in nanoseconds. Values are bucketed
+  // log-linearly in the manner of an HDR histogram: values below 64 are exact,
+  // and every power-of-two range above that is split into 32 linear buckets,
+  // which bounds the relative error of a reported percentile to about 3%.
+  // Recording is wait-free and may happen concurrently with reads.
+  class latency_histogram {
+    static constexpr std::size_t __sub_bucket_bits = 5;
+    static constexpr std::size_t __sub_buckets = std::size_t{1} << __sub_bucket_bits;
+    // One row of exact values below 2 * __sub_buckets, and one row for each
+    // bit width from __sub_bucket_bits + 2 to 64.
+    static constexpr std::size_t __bucket_count = (64 - __sub_bucket_bits + 1) * __sub_buckets;
+
+    static constexpr auto __index_of(std::uint64_t __ns) noexcept -> std::size_t {
+      if (__ns < 2 * __sub_buckets) {
+        return static_cast<std::size_t>(__ns);
+      }
+      auto __shift = static_cast<std::size_t>(std::bit_width(__ns)) - __sub_bucket_bits - 1;
+      return __shift * __sub_buckets + static_cast<std::size_t>(__ns >> __shift);
+    }
+
+    // The largest value that maps to the given bucket.
+    static constexpr auto __highest_of(std::size_t __index) noexcept -> std::uint64_t {
+      if (__index < 2 * __sub_buckets) {
+        return __index;
+      }
+      std::size_t __shift = __index / __sub_buckets - 1;
+      std::uint64_t __mantissa = __index % __sub_buckets + __sub_buckets;
+      return ((__mantissa + 1) << __shift) - 1;
+    }
+
+   public:
+    latency_histogram() = default;
+    latency_histogram(const latency_histogram&) = delete;
+    auto operator=(const latency_histogram&) -> latency_histogram& = delete;
+
+    void record(std::uint64_t __ns) noexcept {
+      __counts_[__index_of(__ns)].fetch_add(1, std::memory_order_relaxed);
+      __sum_.fetch_add(__ns, std::memory_order_relaxed);
+      std::uint64_t __min = __min_.load(std::memory_order_relaxed);
+      while (__ns < __min && !__min_.compare_exchange_weak(__min, __ns, std::memory_order_relaxed)) {
+      }
+      std::uint64_t __max = __max_.load(std::memory_order_relaxed);
+      while (__max < __ns && !__max_.compare_exchange_weak(__max, __ns, std::memory_order_relaxed)) {
+      }
+      __count_.fetch_add(1, std::memory_order_release);
+    }
+
+    template <class _Rep, class _Period>
+    void record(std::chrono::duration<_Rep, _Period> __dur) noexcept {
+      auto __ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__dur).count();
+      record(static_cast<std::uint64_t>(__ns < 0 ? 0 : __ns));
+    }
+
+    [[nodiscard]]
+    auto count() const noexcept -> std::uint64_t {
+      return __count_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]]
+    auto min() const noexcept -> std::uint64_t {
+      return count() == 0 ? 0 : __min_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    auto max() const noexcept -> std::uint64_t {
+      return __max_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    auto mean() const noexcept -> double {
+      auto __n = count();
+      return __n == 0 ? 0.0
+                      : static_cast<double>(__sum_.load(std::memory_order_relaxed))
+                          / static_cast<double>(__n);
+    }
+
+    // Returns the smallest recorded value, up to bucket precision, such that a
+    // fraction `__q` of all recorded values are less than or equal to it.
+    // `percentile(0.5)` is the median and `percentile(0.999)` is the p999.
+    [[nodiscard]]
+    auto percentile(double __q) const noexcept -> std::uint64_t {
+      std::uint64_t __total = count();
+      if (__total == 0) {
+        return 0;
+      }
+      __q = __q < 0.0 ? 0.0 : (__q > 1.0 ? 1.0 : __q);
+      auto __rank = static_cast<std::uint64_t>(std::ceil(__q * static_cast<double>(__total)));
+      __rank = __rank == 0 ? 1 : __rank;
+      std::uint64_t __seen = 0;
+      for (std::size_t __i = 0; __i < __bucket_count; ++__i) {
+        __seen += __counts_[__i].load(std::memory_order_relaxed);
+        if (__seen >= __rank) {
+          auto __value = __highest_of(__i);
+          return __value < max() ? __value : max();
+        }
+      }
+      return max();
+    }
+
+    // Not safe to call concurrently with record().
+    void reset() noexcept {
+      for (auto& __c: __counts_) {
+        __c.store(0, std::memory_order_relaxed);
+      }
+      __sum_.store(0, std::memory_order_relaxed);
+      __min_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+      __max_.store(0, std::memory_order_relaxed);
+      __count_.store(0, std::memory_order_release);
+    }
+
+   private:
+    std::atomic<std::uint64_t> __counts_[__bucket_count]{};
+    std::atomic<std::uint64_t> __count_{0};
+    std::atomic<std::uint64_t> __sum_{0};
+    std::atomic<std::uint64_t> __min_{std::numeric_limits<std::uint64_t>::max()};
+    std::atomic<std::uint64_t> __max_{0};
+  };
+
+  // The latencies of one stage of a pipeline:
+  //  - connect_to_start: from connecting the stage to starting it, which
+  //    includes the time that the operation waited to be started,
+  //  - start_to_completion: from starting the stage to its completion,
+  //  - continuation_hop: from asking a scheduler for a hop to running on it.
+  struct latency_recorder {
+    latency_histogram connect_to_start;
+    latency_histogram start_to_completion;
+    latency_histogram continuation_hop;
+  };
+
+  namespace __instrument {
+    using namespace STDEXEC;
+
+    using __clock = std::chrono::steady_clock;
+
+    // Which histograms an operation records into. Either may be null.
+    struct __stages {
+      latency_histogram* __on_start_;
+      latency_histogram* __on_completion_;
+    };
+
+    template <class _Receiver>
+    struct __opstate_base : __immovable {
+      __opstate_base(_Receiver&& __rcvr, __stages __stages) noexcept
+        : __rcvr_(static_cast<_Receiver&&>(__rcvr))
+        , __stages_(__stages)
+        , __connected_(__clock::now()) {
+      }
+
+      template <class _Tag, class... _Args>
+      void __complete(_Tag, _Args&&... __args) noexcept {
+        if (__stages_.__on_completion_) {
+          __stages_.__on_completion_->record(__clock::now() - __started_);
+        }
+        _Tag()(static_cast<_Receiver&&>(__rcvr_), static_cast<_Args&&>(__args)...);
+      }
+
+      _Receiver __rcvr_;
+      __stages __stages_;
+      __clock::time_point __connected_;
+      __clock::time_point __started_{};
+    };
+
+    template <class _Receiver>
+    struct __receiver {
+      using receiver_concept = STDEXEC::receiver_t;
+
+      template <class... _Args>
+      void set_value(_Args&&... __args) noexcept {
+        __op_->__complete(STDEXEC::set_value, static_cast<_Args&&>(__args)...);
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __err) noexcept {
+        __op_->__complete(STDEXEC::set_error, static_cast<_Error&&>(__err));
+      }
+
+      void set_stopped() noexcept {
+        __op_->__complete(STDEXEC::set_stopped);
+      }
+
+      [[nodiscard]]
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __opstate_base<_Receiver>* __op_;
+    };
+
+    template <class _CvSender, class _Receiver>
+    struct __opstate : __opstate_base<_Receiver> {
+      __opstate(_CvSender&& __sndr, _Receiver __rcvr, __stages __stages)
+        : __opstate_base<_Receiver>(static_cast<_Receiver&&>(__rcvr), __stages)
+        , __child_(STDEXEC::connect(static_cast<_CvSender&&>(__sndr), __receiver<_Receiver>{this})) {
+      }
+
+      void start() & noexcept {
+        this->__started_ = __clock::now();
+        if (this->__stages_.__on_start_) {
+          this->__stages_.__on_start_->record(this->__started_ - this->__connected_);
+        }
+        STDEXEC::start(__child_);
+      }
+
+      connect_result_t<_CvSender, __receiver<_Receiver>> __child_;
+    };
+
+    template <class _Sender, class _Attrs = void>
+    struct __sender {
+      using sender_concept = STDEXEC::sender_t;
+
+      template <__decays_to<__sender> _Self, class _Receiver>
+        requires sender_to<__copy_cvref_t<_Self, _Sender>, __receiver<_Receiver>>
+      STDEXEC_EXPLICIT_THIS_BEGIN(auto connect)(this _Self&& __self, _Receiver __rcvr)
+        -> __opstate<__copy_cvref_t<_Self, _Sender>, _Receiver> {
+        return {
+          static_cast<_Self&&>(__self).__sndr_, static_cast<_Receiver&&>(__rcvr), __self.__stages_};
+      }
+      STDEXEC_EXPLICIT_THIS_END(connect)
+
+      template <__decays_to<__sender> _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        return STDEXEC::get_completion_signatures<__copy_cvref_t<_Self, _Sender>, _Env...>();
+      }
+
+      [[nodiscard]]
+      auto get_env() const noexcept {
+        if constexpr (__same_as<_Attrs, void>) {
+          return __fwd_env(STDEXEC::get_env(__sndr_));
+        } else {
+          return __attrs_;
+        }
+      }
+
+      _Sender __sndr_;
+      __stages __stages_;
+      STDEXEC_ATTRIBUTE(no_unique_address)
+      __if_c<__same_as<_Attrs, void>, __ignore, _Attrs> __attrs_{};
+    };
+
+    template <class _Scheduler>
+    struct __scheduler;
+
+    template <class _Scheduler>
+    struct __schedule_attrs {
+      [[nodiscard]]
+      auto query(get_completion_scheduler_t<set_value_t>, __ignore = {}) const noexcept
+        -> __scheduler<_Scheduler> {
+        return __sched_;
+      }
+
+      __scheduler<_Scheduler> __sched_;
+    };
+
+    // A scheduler adaptor whose schedule operations record the time from
+    // being started to completing on the underlying scheduler, which is the
+    // latency of a continues_on or starts_on hop onto it.
+    template <class _Scheduler>
+    struct __scheduler {
+      using __schedule_sender_t =
+        __sender<schedule_result_t<const _Scheduler&>, __schedule_attrs<_Scheduler>>;
+
+      [[nodiscard]]
+      auto schedule() const -> __schedule_sender_t {
+        return {
+          STDEXEC::schedule(__sched_),
+          {nullptr, &__recorder_->continuation_hop},
+          __schedule_attrs<_Scheduler>{*this}};
+      }
+
+      template <class _Query>
+        requires __queryable_with<const _Scheduler&, _Query>
+      [[nodiscard]]
+      auto query(_Query) const noexcept(__nothrow_queryable_with<const _Scheduler&, _Query>)
+        -> __query_result_t<const _Scheduler&, _Query> {
+        return __query<_Query>()(__sched_);
+      }
+
+      auto operator==(const __scheduler&) const noexcept -> bool = default;
+
+      _Scheduler __sched_;
+      latency_recorder* __recorder_;
+    };
+
+    struct __instrument_t {
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, latency_recorder& __recorder) const
+        -> __sender<__decay_t<_Sender>> {
+        return {
+          static_cast<_Sender&&>(__sndr),
+          {&__recorder.connect_to_start, &__recorder.start_to_completion}};
+      }
+
+      template <scheduler _Scheduler>
+      auto operator()(_Scheduler __sched, latency_recorder& __recorder) const
+        -> __scheduler<_Scheduler> {
+        return {static_cast<_Scheduler&&>(__sched), &__recorder};
+      }
+
+      STDEXEC_ATTRIBUTE(always_inline)
+      auto operator()(latency_recorder& __recorder) const noexcept {
+        return __closure(*this, &__recorder);
+      }
+
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, latency_recorder* __recorder) const
+        -> __sender<__decay_t<_Sender>> {
+        return (*this)(static_cast<_Sender&&>(__sndr), *__recorder);
+      }
+    };
+  } // namespace __instrument
+
+  // Records the latencies of pipeline stages into latency_recorders:
+  //
+  //   exec::latency_recorder hop, parse;
+  //   auto sndr = read_request()
+  //             | continues_on(exec::instrument(pool.get_scheduler(), hop))
+  //             | then(parse_request) | exec::instrument(parse);
+  //
+  //   sndr | exec::instrument(rec)    records connect_to_start and
+  //                                   start_to_completion of `sndr`.
+  //   exec::instrument(sched, rec)    returns a scheduler that records
+  //                                   continuation_hop for every schedule
+  //                                   operation, so `continues_on` and
+  //                                   `starts_on` hops onto it are measured.
+  //
+  // The recorder must outlive the senders and operations that refer to it.
+  inline constexpr __instrument::__instrument_t instrument{};
+} // namespace exec
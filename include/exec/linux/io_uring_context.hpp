@@ -27,6 +27,7 @@
 
 #  include "../__detail/__atomic_intrusive_queue.hpp"
 #  include "../__detail/__bit_cast.hpp"
+#  include "../__detail/__trace.hpp"
 
 #  include "./memory_mapped_region.hpp"
 #  include "./safe_file_descriptor.hpp"
@@ -53,7 +54,9 @@
 #    include <sys/syscall.h>
 #    include <sys/uio.h>
 
+#    include <cstddef>
 #    include <cstring>
+#    include <span>
 
 namespace exec {
   namespace __io_uring {
@@ -181,7 +184,7 @@ namespace exec {
     }
 
     // This class implements the io_uring submission queue.
-    class __submission_queue {
+    class STDEXEC_TRACE_ABI_TAG __submission_queue {
       STDEXEC::__std::atomic_ref<__u32> __head_;
       STDEXEC::__std::atomic_ref<__u32> __tail_;
       __u32* __array_;
@@ -235,6 +238,7 @@ namespace exec {
               __stop(__op);
             } else {
               __sqe.user_data = bit_cast<__u64>(__op);
+              STDEXEC_TRACE(io_submit, __op);
               __array_[__index] = __index;
               ++__result.__n_submitted;
               ++__tail;
@@ -254,7 +258,7 @@ namespace exec {
       }
     };
 
-    class __completion_queue {
+    class STDEXEC_TRACE_ABI_TAG __completion_queue {
       STDEXEC::__std::atomic_ref<__u32> __head_;
       STDEXEC::__std::atomic_ref<__u32> __tail_;
       ::io_uring_cqe* __entries_;
@@ -281,6 +285,7 @@ namespace exec {
           const __u32 __index = __head & __mask_;
           const ::io_uring_cqe& __cqe = __entries_[__index];
           auto* __op = bit_cast<__task*>(__cqe.user_data);
+          STDEXEC_TRACE(io_complete, __op);
           __op->__vtable_->__complete_(__op, __cqe);
           ++__head;
           ++__count;
@@ -291,13 +296,14 @@ namespace exec {
           __task* __op = __ready.pop_front();
           ::io_uring_cqe __dummy_cqe{};
           __dummy_cqe.user_data = bit_cast<__u64>(__op);
+          STDEXEC_TRACE(dequeue, __op);
           __op->__vtable_->__complete_(__op, __dummy_cqe);
         }
         return __count;
       }
     };
 
-    class __context;
+    class STDEXEC_TRACE_ABI_TAG __context;
 
     struct __wakeup_operation : __task {
       __context* __context_ = nullptr;
@@ -350,7 +356,7 @@ namespace exec {
       empty
     };
 
-    class __context : __context_base {
+    class STDEXEC_TRACE_ABI_TAG __context : __context_base {
      public:
       explicit __context(unsigned __entries = 1024, unsigned __flags = 0)
         : __context_base(STDEXEC::__umax({__entries, 2u}), __flags)
@@ -428,6 +434,7 @@ namespace exec {
           __stop(__op);
           return false;
         } else {
+          STDEXEC_TRACE(enqueue, __op);
           __requests_.push_front(__op);
           [[maybe_unused]]
           int __prev = __n_submissions_in_flight_
@@ -507,11 +514,13 @@ namespace exec {
           STDEXEC_ASSERT(
             0 <= __n_total_submitted_
             && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
+          STDEXEC_TRACE(park, __n_total_submitted_);
           int rc = __io_uring_enter(
             __ring_fd_,
             static_cast<unsigned>(__n_newly_submitted_),
             __min_complete,
             IORING_ENTER_GETEVENTS);
+          STDEXEC_TRACE(unpark, rc);
           __throw_error_code_if(rc < 0 && rc != -EINTR, -rc);
           if (rc != -EINTR) {
             STDEXEC_ASSERT(rc <= __n_newly_submitted_);
@@ -1067,6 +1076,66 @@ namespace exec {
     using __schedule_after_operation_t =
       __stoppable_task_facade_t<__schedule_after_operation<_Receiver>>;
 
+    template <class _Receiver>
+    struct __read_operation : __stoppable_op_base<_Receiver> {
+      __read_operation(
+        __context& __context,
+        int __fd,
+        std::span<std::byte> __buffer,
+        ::off_t __offset,
+        _Receiver&& __receiver) noexcept
+        : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+        , __fd_{__fd}
+        , __offset_{__offset}
+        , __iov_{__buffer.data(), __buffer.size()} {
+      }
+
+      static constexpr auto ready() noexcept -> std::false_type {
+        return {};
+      }
+
+#    ifndef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+      // The read cannot be cancelled, so it is left to complete.
+      void submit_stop(::io_uring_sqe& __sqe) noexcept {
+        __sqe = ::io_uring_sqe{.opcode = IORING_OP_NOP};
+      }
+#    endif
+
+      void submit(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.fd = __fd_;
+        __sqe_.off = static_cast<__u64>(__offset_);
+#    ifdef STDEXEC_HAS_IORING_OP_READ
+        __sqe_.opcode = IORING_OP_READ;
+        __sqe_.addr = bit_cast<__u64>(__iov_.iov_base);
+        __sqe_.len = static_cast<__u32>(__iov_.iov_len);
+#    else
+        __sqe_.opcode = IORING_OP_READV;
+        __sqe_.addr = bit_cast<__u64>(&__iov_);
+        __sqe_.len = 1;
+#    endif
+        __sqe = __sqe_;
+      }
+
+      void complete(const ::io_uring_cqe& __cqe) noexcept {
+        if (__cqe.res >= 0) {
+          STDEXEC::set_value(
+            static_cast<_Receiver&&>(this->__rcvr_), static_cast<std::size_t>(__cqe.res));
+        } else {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(this->__rcvr_),
+            std::make_exception_ptr(std::system_error(-__cqe.res, std::system_category())));
+        }
+      }
+
+      int __fd_;
+      ::off_t __offset_;
+      ::iovec __iov_;
+    };
+
+    template <class _Receiver>
+    using __read_operation_t = __stoppable_task_facade_t<__read_operation<_Receiver>>;
+
     class __scheduler {
      public:
       __context* __context_;
@@ -1145,6 +1214,44 @@ namespace exec {
         }
       };
 
+      class __read_sender {
+        using __completions_t = STDEXEC::completion_signatures<
+          STDEXEC::set_value_t(std::size_t),
+          STDEXEC::set_error_t(std::exception_ptr),
+          STDEXEC::set_stopped_t()
+        >;
+
+       public:
+        using sender_concept = STDEXEC::sender_t;
+
+        __schedule_env __env_;
+        int __fd_;
+        std::span<std::byte> __buffer_;
+        ::off_t __offset_;
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class>
+        [[nodiscard]]
+        static consteval auto get_completion_signatures() noexcept -> __completions_t {
+          return __completions_t{};
+        }
+
+        template <STDEXEC::receiver_of<__completions_t> _Receiver>
+        auto connect(_Receiver __receiver) const & -> __read_operation_t<_Receiver> {
+          return __read_operation_t<_Receiver>(
+            std::in_place,
+            *__env_.__context_,
+            __fd_,
+            __buffer_,
+            __offset_,
+            static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
       [[nodiscard]]
       auto schedule() const -> __schedule_sender {
         return __schedule_sender{__schedule_env{__context_}};
@@ -1160,6 +1267,16 @@ namespace exec {
         return __schedule_after_sender{.__env_ = {__context_}, .__duration_ = __duration};
       }
 
+      // Reads up to buffer.size() bytes at offset of the file fd. The sender
+      // completes with the number of bytes read, which is 0 at the end of
+      // the file. The buffer must stay valid until the read has completed.
+      [[nodiscard]]
+      auto read_at(int __fd, std::span<std::byte> __buffer, ::off_t __offset) const noexcept
+        -> __read_sender {
+        return __read_sender{
+          .__env_ = {__context_}, .__fd_ = __fd, .__buffer_ = __buffer, .__offset_ = __offset};
+      }
+
       template <class _Clock, class _Duration>
       [[nodiscard]]
       auto schedule_at(const std::chrono::time_point<_Clock, _Duration>& __time_point) const
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__atomic.hpp"
+#include "../../stdexec/__detail/__parallel_scheduler_backend.hpp"
+#include "../../stdexec/execution.hpp"
+
+#include "./io_uring_context.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace exec {
+  namespace __io_uring_backend {
+    namespace __scr = STDEXEC::system_context_replaceability;
+
+    using __schedule_sender_t = decltype(STDEXEC::schedule(std::declval<io_uring_scheduler>()));
+
+    //! A worker thread that drives its own io_uring. CPU tasks are submitted to the ring as
+    //! ready tasks, so the worker runs them in between reaping I/O completions.
+    struct __worker {
+      explicit __worker(unsigned __entries)
+        : __context_{__entries} {
+      }
+
+      io_uring_context __context_;
+      std::thread __thread_{};
+    };
+
+    //! The worker that the calling thread drives, if any.
+    inline thread_local __worker* __current_worker = nullptr;
+
+    using __env_t = STDEXEC::prop<STDEXEC::get_stop_token_t, STDEXEC::inplace_stop_token>;
+
+    inline auto __stop_token_of(const __scr::receiver_proxy& __rcvr) noexcept
+      -> STDEXEC::inplace_stop_token {
+      auto __o = __rcvr.try_query<STDEXEC::inplace_stop_token>(STDEXEC::get_stop_token);
+      return __o ? *__o : STDEXEC::inplace_stop_token{};
+    }
+
+    struct __schedule_operation;
+
+    struct __schedule_receiver {
+      using receiver_concept = STDEXEC::receiver_t;
+
+      void set_value() noexcept;
+      void set_error(std::exception_ptr) noexcept;
+      void set_stopped() noexcept;
+
+      [[nodiscard]]
+      auto get_env() const noexcept -> __env_t;
+
+      __schedule_operation* __op_;
+    };
+
+    //! The operation state of a `schedule` request; lives in the frontend's preallocated
+    //! storage when it fits there.
+    struct __schedule_operation {
+      __schedule_operation(io_uring_context& __ctx, __scr::receiver_proxy& __rcvr, bool __on_heap)
+        : __rcvr_{&__rcvr}
+        , __on_heap_{__on_heap}
+        , __inner_op_{
+            STDEXEC::connect(STDEXEC::schedule(__ctx.get_scheduler()), __schedule_receiver{this})} {
+      }
+
+      /// Destructs the operation and returns the frontend receiver to complete.
+      auto __release() noexcept -> __scr::receiver_proxy* {
+        auto* __rcvr = __rcvr_;
+        if (__on_heap_) {
+          delete this;
+        } else {
+          std::destroy_at(this);
+        }
+        return __rcvr;
+      }
+
+      __scr::receiver_proxy* __rcvr_;
+      bool __on_heap_;
+      STDEXEC::connect_result_t<__schedule_sender_t, __schedule_receiver> __inner_op_;
+    };
+
+    inline void __schedule_receiver::set_value() noexcept {
+      __op_->__release()->set_value();
+    }
+
+    inline void __schedule_receiver::set_error(std::exception_ptr __eptr) noexcept {
+      __op_->__release()->set_error(std::move(__eptr));
+    }
+
+    inline void __schedule_receiver::set_stopped() noexcept {
+      __op_->__release()->set_stopped();
+    }
+
+    inline auto __schedule_receiver::get_env() const noexcept -> __env_t {
+      return STDEXEC::prop{STDEXEC::get_stop_token, __stop_token_of(*__op_->__rcvr_)};
+    }
+
+    struct __bulk_task;
+
+    //! The shared state of a bulk operation. One task is scheduled on each participating
+    //! worker; the tasks claim chunks of iterations from a shared counter, and the last one to
+    //! finish completes the frontend receiver. The state and its tasks share one block of
+    //! memory, which is the frontend's preallocated storage when they fit there.
+    class __bulk_state {
+     public:
+      __bulk_state(
+        __scr::bulk_item_receiver_proxy& __rcvr,
+        size_t __size,
+        size_t __chunk_size,
+        size_t __num_tasks,
+        bool __on_heap) noexcept
+        : __rcvr_{&__rcvr}
+        , __size_{__size}
+        , __chunk_size_{__chunk_size}
+        , __num_tasks_{__num_tasks}
+        , __on_heap_{__on_heap}
+        , __remaining_{__num_tasks} {
+      }
+
+      //! The size of the block that holds the state and `__num_tasks` tasks.
+      static auto __block_size(size_t __num_tasks) noexcept -> size_t;
+
+      //! The tasks, which follow the state in its block.
+      auto __tasks() noexcept -> __bulk_task*;
+
+      void __run() noexcept {
+        while (true) {
+          const size_t __begin =
+            __next_.fetch_add(__chunk_size_, STDEXEC::__std::memory_order_relaxed);
+          if (__begin >= __size_) {
+            return;
+          }
+          __rcvr_->execute(__begin, (std::min) (__begin + __chunk_size_, __size_));
+        }
+      }
+
+      void __stopped() noexcept {
+        __stopped_.store(true, STDEXEC::__std::memory_order_relaxed);
+      }
+
+      //! Called once by each task when it is done; the last one completes the frontend.
+      void __arrive() noexcept {
+        if (__remaining_.fetch_sub(1, STDEXEC::__std::memory_order_acq_rel) != 1) {
+          return;
+        }
+        const bool __stopped = __stopped_.load(STDEXEC::__std::memory_order_relaxed);
+        auto* __rcvr = __rcvr_;
+        __release(__num_tasks_);
+        if (__stopped) {
+          __rcvr->set_stopped();
+        } else {
+          __rcvr->set_value();
+        }
+      }
+
+      //! Destroys the first `__num_constructed` tasks and the state, and frees the block if it
+      //! was allocated. The frontend's storage must not be touched afterwards.
+      void __release(size_t __num_constructed) noexcept;
+
+      [[nodiscard]]
+      auto __receiver() const noexcept -> __scr::bulk_item_receiver_proxy& {
+        return *__rcvr_;
+      }
+
+     private:
+      __scr::bulk_item_receiver_proxy* __rcvr_;
+      size_t __size_;
+      size_t __chunk_size_;
+      size_t __num_tasks_;
+      bool __on_heap_;
+      STDEXEC::__std::atomic<size_t> __next_{0};
+      STDEXEC::__std::atomic<size_t> __remaining_;
+      STDEXEC::__std::atomic<bool> __stopped_{false};
+    };
+
+    struct __bulk_receiver {
+      using receiver_concept = STDEXEC::receiver_t;
+
+      void set_value() noexcept;
+      void set_error(std::exception_ptr) noexcept;
+      void set_stopped() noexcept;
+
+      [[nodiscard]]
+      auto get_env() const noexcept -> __env_t;
+
+      __bulk_task* __task_;
+    };
+
+    //! One worker's share of a bulk operation.
+    struct __bulk_task {
+      __bulk_task(io_uring_context& __ctx, __bulk_state* __state)
+        : __state_{__state}
+        , __inner_op_{
+            STDEXEC::connect(STDEXEC::schedule(__ctx.get_scheduler()), __bulk_receiver{this})} {
+      }
+
+      __bulk_state* __state_;
+      STDEXEC::connect_result_t<__schedule_sender_t, __bulk_receiver> __inner_op_;
+    };
+
+    //! The alignment of the block that holds a bulk state and its tasks.
+    inline constexpr size_t __bulk_block_align =
+      (std::max) (alignof(__bulk_state), alignof(__bulk_task));
+
+    inline constexpr size_t __bulk_tasks_offset =
+      (sizeof(__bulk_state) + alignof(__bulk_task) - 1) / alignof(__bulk_task)
+      * alignof(__bulk_task);
+
+    inline auto __bulk_state::__block_size(size_t __num_tasks) noexcept -> size_t {
+      return __bulk_tasks_offset + __num_tasks * sizeof(__bulk_task);
+    }
+
+    inline auto __bulk_state::__tasks() noexcept -> __bulk_task* {
+      return reinterpret_cast<__bulk_task*>(
+        reinterpret_cast<std::byte*>(this) + __bulk_tasks_offset);
+    }
+
+    inline void __bulk_state::__release(size_t __num_constructed) noexcept {
+      std::destroy_n(__tasks(), __num_constructed);
+      const bool __on_heap = __on_heap_;
+      void* __block = this;
+      std::destroy_at(this);
+      if (__on_heap) {
+        ::operator delete(__block, std::align_val_t{__bulk_block_align});
+      }
+    }
+
+    inline void __bulk_receiver::set_value() noexcept {
+      __task_->__state_->__run();
+      __task_->__state_->__arrive();
+    }
+
+    inline void __bulk_receiver::set_error(std::exception_ptr) noexcept {
+      // Scheduling onto an io_uring never fails once the operation was started.
+      set_stopped();
+    }
+
+    inline void __bulk_receiver::set_stopped() noexcept {
+      __task_->__state_->__stopped();
+      __task_->__state_->__arrive();
+    }
+
+    inline auto __bulk_receiver::get_env() const noexcept -> __env_t {
+      return STDEXEC::prop{
+        STDEXEC::get_stop_token, __stop_token_of(__task_->__state_->__receiver())};
+    }
+  } // namespace __io_uring_backend
+
+  /// A `parallel_scheduler_backend` whose worker threads each drive their own
+  /// `io_uring_context`. CPU work submitted through the parallel scheduler runs on the same
+  /// threads that reap I/O completions, so work scheduled with `io_scheduler()` from inside a
+  /// parallel task completes on the worker that issued it, without a hop through a dedicated
+  /// I/O thread.
+  ///
+  /// Install it with `set_parallel_scheduler_backend`, or return it from a replacement of
+  /// `query_parallel_scheduler_backend`. Builds with `STDEXEC_ENABLE_IO_URING` can also make
+  /// it the default backend by defining `STDEXEC_SYSTEM_CONTEXT_USE_IO_URING=1`.
+  class io_uring_parallel_scheduler_backend
+    : public STDEXEC::system_context_replaceability::parallel_scheduler_backend {
+    using __worker_t = __io_uring_backend::__worker;
+
+   public:
+    explicit io_uring_parallel_scheduler_backend(
+      size_t __num_workers = std::thread::hardware_concurrency(),
+      unsigned __entries = 1024) {
+      __num_workers = (std::max) (__num_workers, size_t{1});
+      __workers_.reserve(__num_workers);
+      for (size_t __i = 0; __i < __num_workers; ++__i) {
+        __workers_.push_back(std::make_unique<__worker_t>(__entries));
+      }
+      STDEXEC_TRY {
+        for (auto& __worker: __workers_) {
+          __worker->__thread_ = std::thread{[__w = __worker.get()] {
+            __io_uring_backend::__current_worker = __w;
+            __w->__context_.run_until_stopped();
+          }};
+        }
+      }
+      STDEXEC_CATCH_ALL {
+        __stop();
+        STDEXEC_THROW();
+      }
+    }
+
+    io_uring_parallel_scheduler_backend(io_uring_parallel_scheduler_backend&&) = delete;
+
+    ~io_uring_parallel_scheduler_backend() override {
+      __stop();
+    }
+
+    [[nodiscard]]
+    auto available_parallelism() const noexcept -> size_t {
+      return __workers_.size();
+    }
+
+    /// Returns the I/O scheduler of the calling worker thread. When called from a thread that
+    /// is not one of this backend's workers, returns the scheduler of one of the workers.
+    [[nodiscard]]
+    auto io_scheduler() noexcept -> io_uring_scheduler {
+      if (auto* __worker = __this_worker()) {
+        return __worker->__context_.get_scheduler();
+      }
+      return __next_worker().__context_.get_scheduler();
+    }
+
+    void schedule(
+      STDEXEC::system_context_replaceability::receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept override {
+      __schedule(__rcvr, __storage);
+    }
+
+    //! Spreads the batch over the workers, without going through the virtual `schedule`.
+    void schedule_batch(std::span<STDEXEC::system_context_replaceability::batch_entry> __batch)
+      noexcept override {
+      for (auto& __entry: __batch) {
+        __schedule(*__entry.receiver, __entry.storage);
+      }
+    }
+
+    void schedule_bulk_chunked(
+      size_t __size,
+      STDEXEC::system_context_replaceability::bulk_item_receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept override {
+      // Without a chunk size from the frontend, aim for 4 chunks per worker so that the
+      // workers that are busy with I/O completions can be balanced by the others.
+      const std::optional<size_t> __fixed_chunk_size = __rcvr.try_query<size_t>(
+        STDEXEC::system_context_replaceability::get_bulk_chunk_size);
+      const size_t __chunk_size = __fixed_chunk_size
+                                  ? (std::max) (*__fixed_chunk_size, size_t{1})
+                                  : (std::max) (__size / (__workers_.size() * 4), size_t{1});
+      __schedule_bulk(__size, __chunk_size, __rcvr, __storage);
+    }
+
+    void schedule_bulk_unchunked(
+      size_t __size,
+      STDEXEC::system_context_replaceability::bulk_item_receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept override {
+      __schedule_bulk(__size, 1, __rcvr, __storage);
+    }
+
+   private:
+    void __schedule(
+      STDEXEC::system_context_replaceability::receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept {
+      using __operation_t = __io_uring_backend::__schedule_operation;
+      STDEXEC_TRY {
+        auto& __ctx = __next_worker().__context_;
+        void* __ptr = __storage.data();
+        size_t __space = __storage.size();
+        __operation_t* __op = nullptr;
+        if (std::align(alignof(__operation_t), sizeof(__operation_t), __ptr, __space)) {
+          __op = ::new (__ptr) __operation_t{__ctx, __rcvr, false};
+        } else {
+          __op = new __operation_t{__ctx, __rcvr, true};
+        }
+        STDEXEC::start(__op->__inner_op_);
+      }
+      STDEXEC_CATCH_ALL {
+        __rcvr.set_error(std::current_exception());
+      }
+    }
+
+    void __schedule_bulk(
+      size_t __size,
+      size_t __chunk_size,
+      STDEXEC::system_context_replaceability::bulk_item_receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept {
+      using __state_t = __io_uring_backend::__bulk_state;
+      using __task_t = __io_uring_backend::__bulk_task;
+      constexpr size_t __block_align = __io_uring_backend::__bulk_block_align;
+      if (__size == 0) {
+        __rcvr.set_value();
+        return;
+      }
+      const size_t __num_chunks = (__size + __chunk_size - 1) / __chunk_size;
+      const size_t __num_tasks = (std::min) (__workers_.size(), __num_chunks);
+      const size_t __block_size = __state_t::__block_size(__num_tasks);
+
+      // The state and its tasks go into one block: the frontend's storage if they fit there,
+      // a single allocation otherwise.
+      void* __block = __storage.data();
+      size_t __space = __storage.size();
+      const bool __on_heap =
+        std::align(__block_align, __block_size, __block, __space) == nullptr;
+      STDEXEC_TRY {
+        if (__on_heap) {
+          __block = ::operator new(__block_size, std::align_val_t{__block_align});
+        }
+      }
+      STDEXEC_CATCH_ALL {
+        __rcvr.set_error(std::current_exception());
+        return;
+      }
+      auto* __state =
+        ::new (__block) __state_t{__rcvr, __size, __chunk_size, __num_tasks, __on_heap};
+
+      // Connect all the tasks before starting any of them, so that a failure does not leave
+      // the operation partially started.
+      __task_t* __tasks = __state->__tasks();
+      size_t __num_connected = 0;
+      STDEXEC_TRY {
+        for (; __num_connected < __num_tasks; ++__num_connected) {
+          ::new (static_cast<void*>(__tasks + __num_connected))
+            __task_t{__next_worker().__context_, __state};
+        }
+      }
+      STDEXEC_CATCH_ALL {
+        __state->__release(__num_connected);
+        __rcvr.set_error(std::current_exception());
+        return;
+      }
+      for (size_t __i = 0; __i < __num_tasks; ++__i) {
+        STDEXEC::start(__tasks[__i].__inner_op_);
+      }
+    }
+
+    auto __next_worker() noexcept -> __worker_t& {
+      const size_t __i = __next_.fetch_add(1, STDEXEC::__std::memory_order_relaxed);
+      return *__workers_[__i % __workers_.size()];
+    }
+
+    [[nodiscard]]
+    auto __this_worker() const noexcept -> __worker_t* {
+      auto* __current = __io_uring_backend::__current_worker;
+      for (auto& __worker: __workers_) {
+        if (__worker.get() == __current) {
+          return __current;
+        }
+      }
+      return nullptr;
+    }
+
+    void __stop() noexcept {
+      for (auto& __worker: __workers_) {
+        if (__worker->__context_.request_stop()) {
+          std::terminate();
+        }
+      }
+      for (auto& __worker: __workers_) {
+        if (__worker->__thread_.joinable()) {
+          __worker->__thread_.join();
+        }
+      }
+    }
+
+    std::vector<std::unique_ptr<__worker_t>> __workers_;
+    STDEXEC::__std::atomic<size_t> __next_{0};
+  };
+} // namespace exec
@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#if STDEXEC_HAS_STD_RANGES()
+
+#  include "../../stdexec/__detail/__optional.hpp"
+#  include "../../stdexec/execution.hpp"
+
+#  include "../sequence/iterate.hpp"
+#  include "../sequence/transform_each.hpp"
+#  include "../sequence_senders.hpp"
+#  include "../trampoline_scheduler.hpp"
+#  include "./memory_mapped_region.hpp"
+
+#  include <sys/types.h>
+#  include <unistd.h>
+
+#  include <algorithm>
+#  include <cerrno>
+#  include <cstddef>
+#  include <exception>
+#  include <memory>
+#  include <mutex>
+#  include <ranges>
+#  include <span>
+#  include <system_error>
+#  include <utility>
+
+namespace exec {
+  namespace __read_blocks {
+    using namespace STDEXEC;
+
+    using __block_t = std::span<const std::byte>;
+    using __item_sender_t = __call_result_t<just_t, __block_t>;
+
+    // Reads with ::pread on the thread of the scheduler.
+    struct __pread_fn {
+      auto operator()() const -> std::size_t {
+        while (true) {
+          ::ssize_t __n = ::pread(__fd_, __buffer_.data(), __buffer_.size(), __offset_);
+          if (__n >= 0) {
+            return static_cast<std::size_t>(__n);
+          }
+          if (errno != EINTR) {
+            STDEXEC_THROW(std::system_error(errno, std::system_category()));
+          }
+        }
+      }
+
+      int __fd_;
+      std::span<std::byte> __buffer_;
+      ::off_t __offset_;
+    };
+
+    // Schedulers such as io_uring_scheduler read asynchronously.
+    template <class _Scheduler>
+    concept __has_read_at = requires(const _Scheduler& __sched, std::span<std::byte> __buffer) {
+      { __sched.read_at(0, __buffer, ::off_t{}) } -> sender;
+    };
+
+    template <class _Scheduler>
+    auto __read_at(
+      const _Scheduler& __sched,
+      int __fd,
+      std::span<std::byte> __buffer,
+      ::off_t __offset) {
+      if constexpr (__has_read_at<_Scheduler>) {
+        return __sched.read_at(__fd, __buffer, __offset);
+      } else {
+        return STDEXEC::then(STDEXEC::schedule(__sched), __pread_fn{__fd, __buffer, __offset});
+      }
+    }
+
+    template <class _Scheduler>
+    using __read_sender_t = decltype(__read_blocks::__read_at(
+      __declval<const _Scheduler&>(),
+      0,
+      std::span<std::byte>{},
+      ::off_t{}));
+
+    template <class _Scheduler, class _Receiver>
+    struct __operation;
+
+    template <class _Scheduler, class _Receiver>
+    struct __read_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value(std::size_t __size) noexcept {
+        __op_->__read_done(__slot_, __size);
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __op_->__store_error(static_cast<_Error&&>(__error));
+        __op_->__read_done(__slot_, 0);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__break();
+        __op_->__read_done(__slot_, 0);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __operation<_Scheduler, _Receiver>* __op_;
+      std::size_t __slot_;
+    };
+
+    template <class _Scheduler, class _Receiver>
+    struct __next_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__consumed(false);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__consumed(true);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __operation<_Scheduler, _Receiver>* __op_;
+    };
+
+    template <class _Scheduler>
+    struct __params {
+      _Scheduler __sched_;
+      int __fd_;
+      std::size_t __block_size_;
+      std::size_t __readahead_;
+    };
+
+    //
+    // The file is read into __readahead_ buffers of __block_size_ bytes, and
+    // the k-th block is read into buffer k % __readahead_. Up to
+    // __readahead_ reads are in flight while the blocks are emitted one at a
+    // time and in order. The buffer of a block is read into again once the
+    // next-sender of that block has completed.
+    //
+    // A read that returns fewer bytes than requested is continued until the
+    // block is full or a read returns 0 at the end of the file. The sequence
+    // ends at the first block that is shorter than __block_size_. Once it has
+    // ended, the operation completes as soon as the reads that are still in
+    // flight have completed.
+    //
+    // The completions of the reads and of the next-senders only record what
+    // happened. One thread at a time runs __run, which starts the reads,
+    // emits the blocks and completes the operation. It decides to complete
+    // under the same lock that the completions take, so no other thread can
+    // still be using the operation by then.
+    //
+    template <class _Scheduler, class _Receiver>
+    struct __operation {
+      using __read_receiver_t = __read_receiver<_Scheduler, _Receiver>;
+      using __read_op_t = connect_result_t<__read_sender_t<_Scheduler>, __read_receiver_t>;
+      using __next_receiver_t = __next_receiver<_Scheduler, _Receiver>;
+      using __next_op_t =
+        connect_result_t<next_sender_of_t<_Receiver, __item_sender_t>, __next_receiver_t>;
+
+      struct __slot {
+        __optional<__read_op_t> __op_;
+        std::size_t __block_ = 0;
+        // The number of bytes of the block that have been read so far.
+        std::size_t __size_ = 0;
+        bool __ready_ = false;
+        // The last read was short, and the rest of the block is still to be
+        // read.
+        bool __partial_ = false;
+      };
+
+      enum class __action {
+        __none,
+        __read,
+        __emit,
+        __complete
+      };
+
+      __operation(__params<_Scheduler> __prms, _Receiver __rcvr)
+        : __params_{static_cast<__params<_Scheduler>&&>(__prms)}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __storage_{
+            std::make_unique<std::byte[]>(__params_.__block_size_ * __params_.__readahead_)}
+        , __slots_{std::make_unique<__slot[]>(__params_.__readahead_)} {
+      }
+
+      void start() & noexcept {
+        __running_ = true;
+        __run();
+      }
+
+      auto __buffer(std::size_t __slot) const noexcept -> std::byte* {
+        return __storage_.get() + __slot * __params_.__block_size_;
+      }
+
+      void __run() noexcept {
+        while (true) {
+          std::size_t __index = 0;
+          __action __act = __action::__none;
+          {
+            std::scoped_lock __lock{__mutex_};
+            __act = __next_action(__index);
+            if (__act == __action::__none) {
+              // A completion that is recorded from now on runs the loop again.
+              __running_ = false;
+              return;
+            }
+          }
+          switch (__act) {
+          case __action::__read:
+            __start_read(__index);
+            break;
+          case __action::__emit:
+            __emit(__index);
+            break;
+          default:
+            __complete();
+            return;
+          }
+        }
+      }
+
+      // Called with the lock held.
+      auto __next_action(std::size_t& __index) noexcept -> __action {
+        while (__partial_reads_ != 0) {
+          --__partial_reads_;
+          __index = 0;
+          while (!__slots_[__index].__partial_) {
+            ++__index;
+          }
+          __slot& __s = __slots_[__index];
+          __s.__partial_ = false;
+          if (!__done_) {
+            return __action::__read;
+          }
+          // The rest of the block is not needed anymore.
+          __s.__ready_ = true;
+          --__in_flight_;
+        }
+        if (!__done_ && __next_read_ < __next_emit_ + __params_.__readahead_) {
+          __index = __next_read_ % __params_.__readahead_;
+          __slot& __s = __slots_[__index];
+          __s.__block_ = __next_read_++;
+          __s.__size_ = 0;
+          __s.__ready_ = false;
+          ++__in_flight_;
+          return __action::__read;
+        }
+        if (__emitting_) {
+          return __action::__none;
+        }
+        if (!__done_) {
+          __index = __next_emit_ % __params_.__readahead_;
+          __slot& __s = __slots_[__index];
+          if (!__s.__ready_ || __s.__block_ != __next_emit_) {
+            return __action::__none;
+          }
+          if (__s.__size_ != 0) {
+            __emitting_ = true;
+            return __action::__emit;
+          }
+          // The end of the file.
+          __done_ = true;
+        }
+        return __in_flight_ == 0 ? __action::__complete : __action::__none;
+      }
+
+      // Reads the rest of the block of the slot.
+      void __start_read(std::size_t __index) noexcept {
+        __slot& __s = __slots_[__index];
+        STDEXEC_TRY {
+          auto __offset =
+            static_cast<::off_t>(__s.__block_ * __params_.__block_size_ + __s.__size_);
+          STDEXEC::start(__s.__op_.__emplace_from(
+            STDEXEC::connect,
+            __read_blocks::__read_at(
+              __params_.__sched_,
+              __params_.__fd_,
+              std::span<std::byte>{
+                __buffer(__index) + __s.__size_, __params_.__block_size_ - __s.__size_},
+              __offset),
+            __read_receiver_t{this, __index}));
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __read_done(__index, 0);
+        }
+      }
+
+      void __read_done(std::size_t __index, std::size_t __size) noexcept {
+        {
+          std::scoped_lock __lock{__mutex_};
+          __slot& __s = __slots_[__index];
+          __s.__size_ += __size;
+          if (__size == 0 || __s.__size_ == __params_.__block_size_) {
+            __s.__ready_ = true;
+            --__in_flight_;
+          } else {
+            __s.__partial_ = true;
+            ++__partial_reads_;
+          }
+          if (std::exchange(__running_, true)) {
+            return;
+          }
+        }
+        __run();
+      }
+
+      void __emit(std::size_t __index) noexcept {
+        STDEXEC_TRY {
+          STDEXEC::start(__next_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__rcvr_, just(__block_t{__buffer(__index), __slots_[__index].__size_})),
+            __next_receiver_t{this}));
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __consumed(false);
+        }
+      }
+
+      void __consumed(bool __stopped) noexcept {
+        {
+          std::scoped_lock __lock{__mutex_};
+          __slot& __s = __slots_[__next_emit_ % __params_.__readahead_];
+          if (__stopped) {
+            __consumer_stopped_ = true;
+            __done_ = true;
+          } else if (__s.__size_ < __params_.__block_size_) {
+            // A short block is the last one.
+            __done_ = true;
+          }
+          __s.__ready_ = false;
+          ++__next_emit_;
+          __emitting_ = false;
+          if (std::exchange(__running_, true)) {
+            return;
+          }
+        }
+        __run();
+      }
+
+      template <class _Error>
+      void __store_error(_Error&& __error) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __done_ = true;
+        if (!__error_) {
+          if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+            __error_ = static_cast<_Error&&>(__error);
+          } else {
+            __error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+          }
+        }
+      }
+
+      void __break() noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __done_ = true;
+        __stopped_ = true;
+      }
+
+      void __complete() noexcept {
+        if (__error_) {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(__rcvr_), static_cast<std::exception_ptr&&>(__error_));
+        } else if (__stopped_) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else if (__consumer_stopped_) {
+          __set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+        }
+      }
+
+      __params<_Scheduler> __params_;
+      _Receiver __rcvr_;
+      std::unique_ptr<std::byte[]> __storage_;
+      std::unique_ptr<__slot[]> __slots_;
+      std::mutex __mutex_;
+      std::size_t __next_read_ = 0;
+      std::size_t __next_emit_ = 0;
+      std::size_t __in_flight_ = 0;
+      std::size_t __partial_reads_ = 0;
+      bool __running_ = false;
+      bool __emitting_ = false;
+      bool __done_ = false;
+      bool __stopped_ = false;
+      bool __consumer_stopped_ = false;
+      std::exception_ptr __error_;
+      __optional<__next_op_t> __next_op_;
+    };
+
+    template <class _Scheduler>
+    struct __sequence {
+      using sender_concept = sequence_sender_t;
+      using item_types = exec::item_types<__item_sender_t>;
+      using completion_signatures = STDEXEC::completion_signatures<
+        set_value_t(),
+        set_error_t(std::exception_ptr),
+        set_stopped_t()
+      >;
+
+      template <sequence_receiver_of<item_types> _Receiver>
+      auto subscribe(_Receiver __rcvr) const -> __operation<_Scheduler, _Receiver> {
+        return {__params_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      __params<_Scheduler> __params_;
+    };
+
+    struct __region_block_fn {
+      auto operator()(std::size_t __index) const noexcept -> __block_t {
+        std::size_t __offset = __index * __block_size_;
+        return {__data_ + __offset, (std::min) (__block_size_, __size_ - __offset)};
+      }
+
+      const std::byte* __data_;
+      std::size_t __size_;
+      std::size_t __block_size_;
+    };
+
+    //
+    // read_blocks is a sequence source that yields the contents of a file in
+    // blocks of block_size bytes, as std::span<const std::byte>. The last
+    // block is shorter if the size of the file is not a multiple of
+    // block_size.
+    //
+    // read_blocks(sched, fd, block_size, readahead) keeps up to readahead
+    // reads in flight on the scheduler sched, so that the next blocks are
+    // read while the current one is processed. If sched provides
+    // read_at(fd, buffer, offset), as io_uring_scheduler does, it is used to
+    // read asynchronously. Otherwise ::pread is called on a thread of sched.
+    // A block is only valid until its next-sender has completed.
+    //
+    // read_blocks(fd, block_size) reads one block at a time with ::pread on
+    // the trampoline scheduler.
+    //
+    // read_blocks(region, block_size) yields the blocks of a memory mapped
+    // region without copying. The region must outlive the sequence.
+    //
+    // The file descriptor must stay open until the sequence has completed.
+    //
+    struct read_blocks_t {
+      template <scheduler _Scheduler>
+      auto operator()(
+        _Scheduler __sched,
+        int __fd,
+        std::size_t __block_size,
+        std::size_t __readahead) const -> __sequence<_Scheduler> {
+        STDEXEC_ASSERT(__block_size != 0 && __readahead != 0);
+        return {
+          {static_cast<_Scheduler&&>(__sched), __fd, __block_size, __readahead}
+        };
+      }
+
+      auto operator()(int __fd, std::size_t __block_size) const
+        -> __sequence<trampoline_scheduler> {
+        return (*this)(trampoline_scheduler{}, __fd, __block_size, 1);
+      }
+
+      auto operator()(const memory_mapped_region& __region, std::size_t __block_size) const {
+        STDEXEC_ASSERT(__block_size != 0);
+        auto __count = (__region.size() + __block_size - 1) / __block_size;
+        return exec::iterate(std::views::iota(std::size_t{0}, __count))
+             | exec::transform_each(STDEXEC::then(__region_block_fn{
+               static_cast<const std::byte*>(__region.data()), __region.size(), __block_size}));
+      }
+    };
+  } // namespace __read_blocks
+
+  using __read_blocks::read_blocks_t;
+  inline constexpr read_blocks_t read_blocks{};
+} // namespace exec
+
+#endif // STDEXEC_HAS_STD_RANGES()
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../../stdexec/__detail/__optional.hpp"
+#include "../../../stdexec/execution.hpp"
+#include "../../sequence_senders.hpp"
+#include "../../timed_scheduler.hpp"
+
+#include <exception>
+#include <mutex>
+#include <utility>
+
+// The parts that the sequence adaptors which collect the values of the items
+// of their input, such as batch, window, debounce and group_by, have in
+// common.
+namespace exec::__buffered {
+  using namespace STDEXEC;
+
+  template <class... _Env>
+  struct __item_value_fn {
+    template <class _Item>
+    using __f = __decay_t<__single_sender_value_t<_Item, _Env...>>;
+  };
+
+  // The value type of the items of _Sequence, or __ if it has no items.
+  template <class _Sequence, class _Env>
+  using __value_of_t = __mapply<
+    __mtransform<__item_value_fn<_Env>, __munique<__msingle_or<__>>>,
+    item_types_of_t<_Sequence, _Env>
+  >;
+
+  // Completes __rcvr with the stored error if there is one, with
+  // set_stopped() if the sequence has been stopped, and with set_value()
+  // otherwise.
+  template <class _Receiver>
+  void
+    __complete_receiver(_Receiver& __rcvr, std::exception_ptr& __error, bool __stopped) noexcept {
+    if (__error) {
+      STDEXEC::set_error(
+        static_cast<_Receiver&&>(__rcvr), static_cast<std::exception_ptr&&>(__error));
+    } else if (__stopped) {
+      STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr));
+    } else {
+      STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr));
+    }
+  }
+
+  //
+  // The first error of an item or of the input sequence is stored and breaks
+  // the operation: the values that arrive afterwards are dropped, the
+  // next-senders of their items complete with set_stopped(), which stops the
+  // producer, and the error is delivered as set_error(std::exception_ptr)
+  // once the operation completes. A downstream next-sender that completes
+  // with set_stopped() breaks the operation as well, which then completes
+  // with set_stopped().
+  //
+  struct __error_state {
+    template <class _Error>
+    void __store_error(_Error&& __error) noexcept {
+      std::scoped_lock __lock{__mutex_};
+      __broken_ = true;
+      if (!__error_) {
+        if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+          __error_ = static_cast<_Error&&>(__error);
+        } else {
+          __error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+        }
+      }
+    }
+
+    void __break() noexcept {
+      std::scoped_lock __lock{__mutex_};
+      __broken_ = true;
+      __stopped_ = true;
+    }
+
+    std::mutex __mutex_;
+    bool __broken_ = false;
+    bool __stopped_ = false;
+    std::exception_ptr __error_;
+  };
+
+  template <class _Receiver>
+  struct __operation_common : __error_state {
+    using __receiver_t = _Receiver;
+
+    explicit __operation_common(_Receiver __rcvr)
+      : __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+    }
+
+    void __complete() noexcept {
+      __buffered::__complete_receiver(__rcvr_, __error_, __stopped_);
+    }
+
+    _Receiver __rcvr_;
+  };
+
+  template <class _OperationBase>
+  struct __push_fn {
+    template <class... _Values>
+    auto operator()(_Values&&... __values) const -> _OperationBase::__push_result_t {
+      using __value_t = _OperationBase::__value_t;
+      return __op_->__push(__value_t(static_cast<_Values&&>(__values)...));
+    }
+
+    _OperationBase* __op_;
+  };
+
+  template <class _OperationBase>
+  struct __error_fn {
+    template <class _Error>
+    auto operator()(_Error&& __error) const noexcept {
+      __op_->__store_error(static_cast<_Error&&>(__error));
+      return just_stopped();
+    }
+
+    _OperationBase* __op_;
+  };
+
+  // The receiver of the input sequence. The values of every item are passed
+  // to __push through _PushFn, and the completion of the input sequence to
+  // __input_complete.
+  template <class _OperationBase, class _PushFn = __push_fn<_OperationBase>>
+  struct __receiver {
+    using receiver_concept = receiver_t;
+
+    template <sender _Item>
+    auto set_next(_Item&& __item) & noexcept(__nothrow_decay_copyable<_Item>)
+      -> next_sender auto {
+      return STDEXEC::let_error(
+        STDEXEC::let_value(static_cast<_Item&&>(__item), _PushFn{__op_}),
+        __error_fn<_OperationBase>{__op_});
+    }
+
+    void set_value() noexcept {
+      __op_->__input_complete();
+    }
+
+    template <class _Error>
+    void set_error(_Error&& __error) noexcept {
+      __op_->__store_error(static_cast<_Error&&>(__error));
+      __op_->__input_complete();
+    }
+
+    void set_stopped() noexcept {
+      __op_->__break();
+      __op_->__input_complete();
+    }
+
+    auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+      return STDEXEC::get_env(__op_->__rcvr_);
+    }
+
+    _OperationBase* __op_;
+  };
+
+  template <class _OperationBase>
+  struct __timer_receiver {
+    using receiver_concept = receiver_t;
+
+    void set_value() noexcept {
+      __op_->__step();
+    }
+
+    template <class _Error>
+    void set_error(_Error&& __error) noexcept {
+      __op_->__store_error(static_cast<_Error&&>(__error));
+      __op_->__step();
+    }
+
+    void set_stopped() noexcept {
+      __op_->__step();
+    }
+
+    auto get_env() const noexcept -> prop<get_stop_token_t, inplace_stop_token> {
+      return prop{get_stop_token, __op_->__timer_stop_.get_token()};
+    }
+
+    _OperationBase* __op_;
+  };
+
+  // The receiver of the downstream next-sender of a value that the operation
+  // emits on its own.
+  template <class _Receiver, class _OperationBase>
+  struct __flush_receiver {
+    using receiver_concept = receiver_t;
+
+    void set_value() noexcept {
+      __op_->__step();
+    }
+
+    void set_stopped() noexcept {
+      __op_->__break();
+      __op_->__step();
+    }
+
+    auto get_env() const noexcept -> env_of_t<_Receiver> {
+      return STDEXEC::get_env(__op_->__rcvr_);
+    }
+
+    _OperationBase* __op_;
+  };
+
+  // What the timer loop does next, as decided by _Derived::__poll.
+  enum class __action_t {
+    __idle,
+    __flush,
+    __arm
+  };
+
+  //
+  // A timer loop emits the values that _Derived collects when they are due.
+  // It runs while values are buffered: every step asks _Derived::__poll,
+  // with the lock held, whether a value of type _Flushed is due, which the
+  // loop then emits and waits for, or how long to wait for the next one, or
+  // whether nothing is buffered anymore, in which case the loop goes idle.
+  // Once the input sequence has completed, __poll is expected to hand out
+  // what is left right away, and the loop completes the operation when
+  // nothing is left.
+  //
+  // _Derived calls __activate with the lock held when it buffers a value,
+  // and arms the timer if that returns true.
+  //
+  template <class _Derived, class _Receiver, class _Scheduler, class _Flushed>
+  struct __timer_loop : __operation_common<_Receiver> {
+    using __time_point_t = time_point_of_t<_Scheduler>;
+    using __duration_t = duration_of_t<_Scheduler>;
+    using __next_sender_t = next_sender_of_t<_Receiver, __call_result_t<just_t, _Flushed>>;
+    using __timer_sender_t = __call_result_t<schedule_after_t, _Scheduler&, const __duration_t&>;
+    using __timer_op_t = connect_result_t<__timer_sender_t, __timer_receiver<__timer_loop>>;
+    using __flush_op_t =
+      connect_result_t<__next_sender_t, __flush_receiver<_Receiver, __timer_loop>>;
+
+    __timer_loop(_Receiver __rcvr, _Scheduler __sched)
+      : __operation_common<_Receiver>{static_cast<_Receiver&&>(__rcvr)}
+      , __sched_{static_cast<_Scheduler&&>(__sched)} {
+    }
+
+    // Returns true if the loop was idle, and the caller has to arm the timer.
+    auto __activate() noexcept -> bool {
+      return !std::exchange(__loop_active_, true);
+    }
+
+    void __step() noexcept {
+      __action_t __action = __action_t::__idle;
+      __optional<_Flushed> __flushed;
+      __duration_t __wait{};
+      bool __complete = false;
+      {
+        std::scoped_lock __lock{this->__mutex_};
+        __action = static_cast<_Derived*>(this)->__poll(__flushed, __wait);
+        if (__action == __action_t::__idle) {
+          __loop_active_ = false;
+          // While __input_complete wakes the loop up, it completes the
+          // operation itself.
+          __complete = __done_ && !__waking_;
+        }
+      }
+      switch (__action) {
+      case __action_t::__flush:
+        __flush(static_cast<_Flushed&&>(*__flushed));
+        break;
+      case __action_t::__arm:
+        __arm_timer(__wait);
+        break;
+      case __action_t::__idle:
+        if (__complete) {
+          this->__complete();
+        }
+      }
+    }
+
+    void __arm_timer(__duration_t __wait) noexcept {
+      STDEXEC_TRY {
+        __timer_op_.__emplace_from(
+          STDEXEC::connect,
+          exec::schedule_after(__sched_, __wait),
+          __timer_receiver<__timer_loop>{this});
+        STDEXEC::start(*__timer_op_);
+      }
+      STDEXEC_CATCH_ALL {
+        this->__store_error(std::current_exception());
+        __step();
+      }
+    }
+
+    void __flush(_Flushed&& __flushed) noexcept {
+      STDEXEC_TRY {
+        __flush_op_.__emplace_from(
+          STDEXEC::connect,
+          exec::set_next(this->__rcvr_, just(static_cast<_Flushed&&>(__flushed))),
+          __flush_receiver<_Receiver, __timer_loop>{this});
+        STDEXEC::start(*__flush_op_);
+      }
+      STDEXEC_CATCH_ALL {
+        this->__store_error(std::current_exception());
+        __step();
+      }
+    }
+
+    // Called when the input sequence has completed. The final step runs on
+    // the timer loop if it is active, so that it is woken up early. The loop
+    // does not complete the operation while it is being woken up, so that
+    // the operation outlives the stop request. If the loop has gone idle in
+    // the meantime, the final step runs here.
+    void __input_complete() noexcept {
+      bool __wake = false;
+      {
+        std::scoped_lock __lock{this->__mutex_};
+        __done_ = true;
+        __wake = __waking_ = std::exchange(__loop_active_, true);
+      }
+      if (__wake) {
+        __timer_stop_.request_stop();
+        std::scoped_lock __lock{this->__mutex_};
+        __waking_ = false;
+        if (std::exchange(__loop_active_, true)) {
+          return;
+        }
+      }
+      __step();
+    }
+
+    _Scheduler __sched_;
+    bool __loop_active_ = false;
+    bool __waking_ = false;
+    bool __done_ = false;
+    inplace_stop_source __timer_stop_;
+    __optional<__timer_op_t> __timer_op_;
+    __optional<__flush_op_t> __flush_op_;
+  };
+} // namespace exec::__buffered
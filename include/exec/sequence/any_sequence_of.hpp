@@ -21,24 +21,44 @@
 #include "../any_sender_of.hpp"
 #include "../sequence_senders.hpp"
 
+#include <cstddef>
+
 namespace exec {
   namespace __any {
     namespace __next {
-      template <__valid_completion_signatures _Sigs>
+      //! The type-erased item sender and the type-erased next-sender that cross the
+      //! boundary for each item. Both keep the erased object and its operation state in
+      //! inline buffers, so that items whose senders fit are passed without allocating.
+      //! The next-sender usually wraps the item sender and its operation state wraps the
+      //! item's, so it gets buffers twice the size.
+      template <class _Sigs, std::size_t _InlineSize, std::size_t _OpInlineSize>
+      using __item_sender_t =
+        any_receiver_ref<_Sigs>::template basic_any_sender<_InlineSize, _OpInlineSize>;
+
+      template <std::size_t _InlineSize, std::size_t _OpInlineSize>
+      using __void_sender_t = __item_sender_t<
+        completion_signatures<set_value_t(), set_stopped_t()>,
+        2 * _InlineSize,
+        2 * _OpInlineSize
+      >;
+
+      template <
+        __valid_completion_signatures _Sigs,
+        std::size_t _InlineSize,
+        std::size_t _OpInlineSize
+      >
       struct __rcvr_next_vfun {
-        using __return_sigs = completion_signatures<set_value_t(), set_stopped_t()>;
-        using __void_sender = any_receiver_ref<__return_sigs>::template any_sender<>;
-        using __item_sender = any_receiver_ref<_Sigs>::template any_sender<>;
+        using __void_sender = __void_sender_t<_InlineSize, _OpInlineSize>;
+        using __item_sender = __item_sender_t<_Sigs, _InlineSize, _OpInlineSize>;
         __void_sender (*__fn_)(void*, __item_sender&&) noexcept;
       };
 
-      template <class _Rcvr>
+      template <class _Rcvr, std::size_t _InlineSize, std::size_t _OpInlineSize>
       struct __rcvr_next_vfun_fn {
-        using __return_sigs = completion_signatures<set_value_t(), set_stopped_t()>;
-        using __void_sender = any_receiver_ref<__return_sigs>::template any_sender<>;
+        using __void_sender = __void_sender_t<_InlineSize, _OpInlineSize>;
 
         template <class _Sigs>
-        using __item_sender = any_receiver_ref<_Sigs>::template any_sender<>;
+        using __item_sender = __item_sender_t<_Sigs, _InlineSize, _OpInlineSize>;
 
         template <__valid_completion_signatures _Sigs>
         constexpr auto
@@ -50,15 +70,33 @@ namespace exec {
         }
       };
 
-      template <class _NextSigs, class _Sigs, class... _Queries>
+      template <
+        class _NextSigs,
+        class _Sigs,
+        class _Queries,
+        std::size_t _InlineSize,
+        std::size_t _OpInlineSize
+      >
       struct __next_vtable;
 
-      template <class _NextSigs, class... _Sigs, class... _Queries>
-      struct __next_vtable<_NextSigs, completion_signatures<_Sigs...>, _Queries...>
-        : __rcvr_next_vfun<_NextSigs>
+      template <
+        class _NextSigs,
+        class... _Sigs,
+        class... _Queries,
+        std::size_t _InlineSize,
+        std::size_t _OpInlineSize
+      >
+      struct __next_vtable<
+        _NextSigs,
+        completion_signatures<_Sigs...>,
+        __mlist<_Queries...>,
+        _InlineSize,
+        _OpInlineSize
+      >
+        : __rcvr_next_vfun<_NextSigs, _InlineSize, _OpInlineSize>
         , __rcvr_vfun<_Sigs>...
         , __query_vfun<_Queries>... {
-        using __item_sender = any_receiver_ref<_NextSigs>::template any_sender<>;
+        using __item_sender = __item_sender_t<_NextSigs, _InlineSize, _OpInlineSize>;
         using __item_types = item_types<__item_sender>;
 
         using __query_vfun<_Queries>::operator()...;
@@ -68,17 +106,18 @@ namespace exec {
                 && (__callable<__query_vfun_fn<_Rcvr>, _Queries> && ...)
         static auto __create_vtable(__mtype<_Rcvr>) noexcept -> const __next_vtable* {
           static const __next_vtable __vtable_{
-            {__rcvr_next_vfun_fn<_Rcvr>{}(static_cast<_NextSigs*>(nullptr))},
+            {__rcvr_next_vfun_fn<_Rcvr, _InlineSize, _OpInlineSize>{}(
+              static_cast<_NextSigs*>(nullptr))},
             {__rcvr_vfun_fn(static_cast<_Rcvr*>(nullptr), static_cast<_Sigs*>(nullptr))}...,
             {__query_vfun_fn<_Rcvr>{}(static_cast<_Queries>(nullptr))}...};
           return &__vtable_;
         }
       };
 
-      template <class _Sigs, class... _Queries>
+      template <class _Sigs, class _Queries, std::size_t _InlineSize, std::size_t _OpInlineSize>
       struct __env {
         using __sigs = __to_sequence_completions_t<_Sigs>;
-        using __vtable_t = __next_vtable<_Sigs, __sigs, _Queries...>;
+        using __vtable_t = __next_vtable<_Sigs, __sigs, _Queries, _InlineSize, _OpInlineSize>;
 
         template <class _Tag, class... _As>
           requires __callable<const __vtable_t&, _Tag, void*, _As...>
@@ -92,24 +131,34 @@ namespace exec {
         void* __rcvr_;
       };
 
-      template <class _Sigs, class... _Queries>
+      template <class _Sigs, class _Queries, std::size_t _InlineSize, std::size_t _OpInlineSize>
       struct __receiver_ref;
 
-      template <class... _Sigs, class... _Queries>
-      struct __receiver_ref<completion_signatures<_Sigs...>, _Queries...> {
-        using __return_sigs = completion_signatures<set_value_t(), set_stopped_t()>;
-        using __void_sender = any_receiver_ref<__return_sigs>::template any_sender<>;
+      template <
+        class... _Sigs,
+        class... _Queries,
+        std::size_t _InlineSize,
+        std::size_t _OpInlineSize
+      >
+      struct __receiver_ref<
+        completion_signatures<_Sigs...>,
+        __mlist<_Queries...>,
+        _InlineSize,
+        _OpInlineSize
+      > {
+        using __void_sender = __void_sender_t<_InlineSize, _OpInlineSize>;
         using __next_sigs = completion_signatures<_Sigs...>;
         using __sigs = __to_sequence_completions_t<__next_sigs>;
-        using __item_sender = any_receiver_ref<__next_sigs>::template any_sender<>;
+        using __item_sender = __item_sender_t<__next_sigs, _InlineSize, _OpInlineSize>;
         using __item_types = item_types<__item_sender>;
 
-        using __vtable_t = __next_vtable<__next_sigs, __sigs, _Queries...>;
+        using __vtable_t =
+          __next_vtable<__next_sigs, __sigs, __mlist<_Queries...>, _InlineSize, _OpInlineSize>;
 
         template <class Sig>
         using __vfun = __rcvr_vfun<Sig>;
 
-        using __env_t = __env<__next_sigs, _Queries...>;
+        using __env_t = __env<__next_sigs, __mlist<_Queries...>, _InlineSize, _OpInlineSize>;
 
         using receiver_concept = STDEXEC::receiver_t;
 
@@ -123,7 +172,8 @@ namespace exec {
         template <class _Sender>
           requires __std::constructible_from<__item_sender, _Sender>
         auto set_next(_Sender&& __sndr) -> __void_sender {
-          const __rcvr_next_vfun<__next_sigs>* __vfun = __env_.__vtable_;
+          const __rcvr_next_vfun<__next_sigs, _InlineSize, _OpInlineSize>* __vfun =
+            __env_.__vtable_;
           return __vfun->__fn_(__env_.__rcvr_, static_cast<_Sender&&>(__sndr));
         }
 
@@ -155,14 +205,26 @@ namespace exec {
       };
     } // namespace __next
 
-    template <class _Sigs, class _Queries>
-    using __next_receiver_ref =
-      __mapply<__mbind_front<__q<__next::__receiver_ref>, _Sigs>, _Queries>;
-
-    template <class _Sigs, class _SenderQueries, class _ReceiverQueries>
+    template <
+      class _Sigs,
+      class _Queries,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      std::size_t _OpInlineSize = __default_operation_inline_size
+    >
+    using __next_receiver_ref = __next::__receiver_ref<_Sigs, _Queries, _InlineSize, _OpInlineSize>;
+
+    template <
+      class _Sigs,
+      class _SenderQueries,
+      class _ReceiverQueries,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      std::size_t _OpInlineSize = __default_operation_inline_size
+    >
     struct __sender_vtable : public __query_vtable<_SenderQueries> {
       using __query_vtable_t = __query_vtable<_SenderQueries>;
-      using __receiver_ref_t = __next_receiver_ref<_Sigs, _ReceiverQueries>;
+      using __receiver_ref_t =
+        __next_receiver_ref<_Sigs, _ReceiverQueries, _InlineSize, _OpInlineSize>;
+      using __operation_storage_t = __immovable_operation_storage_t<_OpInlineSize>;
 
       auto queries() const noexcept -> const __query_vtable_t& {
         return *this;
@@ -173,11 +235,13 @@ namespace exec {
       static auto __create_vtable(__mtype<_Sender>) noexcept -> const __sender_vtable* {
         static const __sender_vtable __vtable_{
           {*__any::__create_vtable(__mtype<__query_vtable_t>{}, __mtype<_Sender>{})},
-          [](void* __object_pointer, __receiver_ref_t __receiver) -> __immovable_operation_storage {
+          [](void* __object_pointer,
+             __receiver_ref_t __receiver,
+             __allocator_ref<std::byte> __alloc) -> __operation_storage_t {
             _Sender& __sender = *static_cast<_Sender*>(__object_pointer);
             using __op_state_t = subscribe_result_t<_Sender, __receiver_ref_t>;
-            return __immovable_operation_storage{
-              std::in_place_type<__op_state_t>, __emplace_from{[&] {
+            return __operation_storage_t{
+              std::allocator_arg, __alloc, std::in_place_type<__op_state_t>, __emplace_from{[&] {
                 return ::exec::subscribe(
                   static_cast<_Sender&&>(__sender), static_cast<__receiver_ref_t&&>(__receiver));
               }}};
@@ -185,13 +249,20 @@ namespace exec {
         return &__vtable_;
       }
 
-      __immovable_operation_storage (*subscribe_)(void*, __receiver_ref_t);
+      __operation_storage_t (*subscribe_)(void*, __receiver_ref_t, __allocator_ref<std::byte>);
     };
 
-    template <class _Sigs, class _SenderQueries, class _ReceiverQueries>
+    template <
+      class _Sigs,
+      class _SenderQueries,
+      class _ReceiverQueries,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      std::size_t _OpInlineSize = __default_operation_inline_size
+    >
     struct __sender_env {
       using __query_vtable_t = __query_vtable<_SenderQueries>;
-      using __vtable_t = __sender_vtable<_Sigs, _SenderQueries, _ReceiverQueries>;
+      using __vtable_t =
+        __sender_vtable<_Sigs, _SenderQueries, _ReceiverQueries, _InlineSize, _OpInlineSize>;
 
       explicit __sender_env(const __vtable_t* __vtable, void* __sender) noexcept
         : __vtable_{__vtable}
@@ -211,14 +282,23 @@ namespace exec {
       void* __sender_;
     };
 
-    template <class _Sigs, class _SenderQueries = __mlist<>, class _ReceiverQueries = __mlist<>>
+    template <
+      class _Sigs,
+      class _SenderQueries = __mlist<>,
+      class _ReceiverQueries = __mlist<>,
+      std::size_t _InlineSize = __default_sender_inline_size,
+      std::size_t _OpInlineSize = __default_operation_inline_size
+    >
     struct __sequence_sender {
-      using __receiver_ref_t = __next_receiver_ref<_Sigs, _ReceiverQueries>;
-      using __vtable_t = __sender_vtable<_Sigs, _SenderQueries, _ReceiverQueries>;
+      using __receiver_ref_t =
+        __next_receiver_ref<_Sigs, _ReceiverQueries, _InlineSize, _OpInlineSize>;
+      using __vtable_t =
+        __sender_vtable<_Sigs, _SenderQueries, _ReceiverQueries, _InlineSize, _OpInlineSize>;
 
       using __completions_t = __to_sequence_completions_t<_Sigs>;
-      using __item_sender_t = any_receiver_ref<_Sigs>::template any_sender<>;
-      using __env_t = __sender_env<_Sigs, _SenderQueries, _ReceiverQueries>;
+      using __item_sender_t = __next::__item_sender_t<_Sigs, _InlineSize, _OpInlineSize>;
+      using __env_t =
+        __sender_env<_Sigs, _SenderQueries, _ReceiverQueries, _InlineSize, _OpInlineSize>;
 
       using completion_signatures = __completions_t;
       using item_types = exec::item_types<__item_sender_t>;
@@ -236,13 +316,15 @@ namespace exec {
       auto operator=(__sequence_sender&&) -> __sequence_sender& = default;
       auto operator=(const __sequence_sender&) -> __sequence_sender& = delete;
 
-      auto __connect(__receiver_ref_t __receiver) -> __immovable_operation_storage {
-        return __storage_.__get_vtable()->subscribe_(__storage_.__get_object_pointer(), __receiver);
+      auto __connect(__receiver_ref_t __receiver, __allocator_ref<std::byte> __alloc)
+        -> __immovable_operation_storage_t<_OpInlineSize> {
+        return __storage_.__get_vtable()->subscribe_(
+          __storage_.__get_object_pointer(), __receiver, __alloc);
       }
 
       template <class _Rcvr>
-      auto subscribe(_Rcvr __rcvr) && -> __operation<_Rcvr, true> {
-        return __operation<_Rcvr, true>{
+      auto subscribe(_Rcvr __rcvr) && -> __operation<_Rcvr, true, _OpInlineSize> {
+        return __operation<_Rcvr, true, _OpInlineSize>{
           static_cast<__sequence_sender&&>(*this), static_cast<_Rcvr&&>(__rcvr)};
       }
 
@@ -251,7 +333,7 @@ namespace exec {
         return __env_t{__storage_.__get_vtable(), __storage_.__get_object_pointer()};
       }
 
-      __unique_storage_t<__vtable_t> __storage_;
+      __unique_storage_t<__vtable_t, _InlineSize> __storage_;
     };
   } // namespace __any
 
@@ -264,8 +346,20 @@ namespace exec {
    public:
     using receiver_concept = STDEXEC::receiver_t;
 
+    //! A type-erased sequence sender whose small-object buffers have caller-chosen sizes.
+    //! `_InlineSize` bytes are reserved for the erased sequence and for the erased item
+    //! sender and next-sender of each item; `_OpInlineSize` bytes are reserved for the
+    //! erased operation states. Streams whose items fit are passed across the type-erased
+    //! boundary without allocating per item.
+    template <std::size_t _InlineSize, std::size_t _OpInlineSize, auto... _SenderQueries>
+    class basic_any_sender;
+
     template <auto... _SenderQueries>
-    class any_sender;
+    using any_sender = basic_any_sender<
+      __any::__default_sender_inline_size,
+      __any::__default_operation_inline_size,
+      _SenderQueries...
+    >;
 
     template <STDEXEC::__not_decays_to<any_sequence_receiver_ref> _Receiver>
       requires sequence_receiver_of<_Receiver, _Completions>
@@ -301,13 +395,16 @@ namespace exec {
   };
 
   template <class _Completions, auto... _ReceiverQueries>
-  template <auto... _SenderQueries>
-  class any_sequence_receiver_ref<_Completions, _ReceiverQueries...>::any_sender {
+  template <std::size_t _InlineSize, std::size_t _OpInlineSize, auto... _SenderQueries>
+  class any_sequence_receiver_ref<_Completions, _ReceiverQueries...>::basic_any_sender {
     using __base_t = __any::__sequence_sender<
       _Completions,
       queries<_SenderQueries...>,
-      queries<_ReceiverQueries...>
+      queries<_ReceiverQueries...>,
+      _InlineSize,
+      _OpInlineSize
     >;
+    using __receiver_ref_t = __base_t::__receiver_ref_t;
     __base_t __sender_;
 
    public:
@@ -315,10 +412,10 @@ namespace exec {
     using completion_signatures = __base_t::completion_signatures;
     using item_types = __base_t::item_types;
 
-    template <STDEXEC::__not_decays_to<any_sender> _Sender>
-      requires STDEXEC::sender_in<_Sender, __env_t>
-            && sequence_sender_to<_Sender, __receiver_base_t>
-    any_sender(_Sender&& __sender)
+    template <STDEXEC::__not_decays_to<basic_any_sender> _Sender>
+      requires STDEXEC::sender_in<_Sender, STDEXEC::env_of_t<__receiver_ref_t>>
+            && sequence_sender_to<_Sender, __receiver_ref_t>
+    basic_any_sender(_Sender&& __sender)
       noexcept(STDEXEC::__nothrow_constructible_from<__base_t, _Sender>)
       : __sender_(static_cast<_Sender&&>(__sender)) {
     }
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__optional.hpp"
+#include "../../stdexec/coroutine.hpp"
+#include "../../stdexec/execution.hpp"
+#include "../../stdexec/stop_token.hpp"
+#include "../sequence_senders.hpp"
+
+#include "../__detail/__frame_allocator.hpp"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace exec {
+  template <class _Ty>
+  class async_generator;
+
+  namespace __async_generator {
+    using namespace STDEXEC;
+
+    // The subscription that drives a generator. The promise calls back into
+    // it through these function pointers, because it does not know the type
+    // of the receiver.
+    struct __consumer {
+      // Emits the value that has just been yielded. Returns false if the
+      // coroutine can continue right away, and true if it stays suspended
+      // until the consumer resumes it, or for good.
+      bool (*__emit_)(__consumer*) noexcept;
+      // The coroutine has run to completion, or exited with an exception.
+      void (*__complete_)(__consumer*) noexcept;
+      // A sender that the coroutine awaited completed with set_stopped().
+      void (*__stopped_)(__consumer*) noexcept;
+      inplace_stop_token __stop_token_;
+    };
+
+    template <class _Ty, class _Receiver>
+    struct __item_operation {
+      void start() & noexcept {
+        STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_), static_cast<_Ty&&>(*__value_));
+      }
+
+      _Ty* __value_;
+      _Receiver __rcvr_;
+    };
+
+    // The item for a yielded value. The value lives in the coroutine frame
+    // and is sent as an rvalue, so it is neither copied nor moved before the
+    // consumer receives it.
+    template <class _Ty>
+    struct __item_sender {
+      using sender_concept = sender_t;
+      using completion_signatures = STDEXEC::completion_signatures<set_value_t(_Ty)>;
+
+      template <receiver_of<completion_signatures> _Receiver>
+      auto connect(_Receiver __rcvr) const noexcept -> __item_operation<_Ty, _Receiver> {
+        return {__value_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      _Ty* __value_;
+    };
+
+    template <class _Ty>
+    struct __promise : __frame::__with_frame_allocator {
+      struct __yield_awaiter {
+        static constexpr auto await_ready() noexcept -> bool {
+          return false;
+        }
+
+        auto await_suspend(__std::coroutine_handle<>) const noexcept -> bool {
+          return __promise_->__consumer_->__emit_(__promise_->__consumer_);
+        }
+
+        static constexpr void await_resume() noexcept {
+        }
+
+        __promise* __promise_;
+      };
+
+      struct __final_awaiter {
+        static constexpr auto await_ready() noexcept -> bool {
+          return false;
+        }
+
+        static void await_suspend(__std::coroutine_handle<__promise> __h) noexcept {
+          __consumer* __cons = __h.promise().__consumer_;
+          __cons->__complete_(__cons);
+        }
+
+        static constexpr void await_resume() noexcept {
+        }
+      };
+
+      auto get_return_object() noexcept -> async_generator<_Ty> {
+        return async_generator<_Ty>{__std::coroutine_handle<__promise>::from_promise(*this)};
+      }
+
+      static constexpr auto initial_suspend() noexcept -> __std::suspend_always {
+        return {};
+      }
+
+      static constexpr auto final_suspend() noexcept -> __final_awaiter {
+        return {};
+      }
+
+      void return_void() noexcept {
+      }
+
+      void unhandled_exception() noexcept {
+        __error_ = std::current_exception();
+      }
+
+      auto unhandled_stopped() noexcept -> __std::coroutine_handle<> {
+        __consumer_->__stopped_(__consumer_);
+        // The coroutine never resumes past the co_await of the stopped sender.
+        return __std::noop_coroutine();
+      }
+
+      auto yield_value(_Ty&& __value) noexcept -> __yield_awaiter {
+        __value_ = std::addressof(__value);
+        return {this};
+      }
+
+      // A yielded lvalue is copied into the frame, in storage that is reused
+      // for every such value.
+      auto yield_value(const _Ty& __value) -> __yield_awaiter
+        requires std::copy_constructible<_Ty>
+      {
+        __value_ = std::addressof(__copy_.emplace(__value));
+        return {this};
+      }
+
+      template <class _Value>
+      auto await_transform(_Value&& __value) -> decltype(auto) {
+        return STDEXEC::as_awaitable(static_cast<_Value&&>(__value), *this);
+      }
+
+      auto get_env() const noexcept {
+        return prop{get_stop_token, __consumer_->__stop_token_};
+      }
+
+      __consumer* __consumer_ = nullptr;
+      _Ty* __value_ = nullptr;
+      __optional<_Ty> __copy_;
+      std::exception_ptr __error_;
+    };
+
+    template <class _Ty, class _Receiver>
+    struct __operation;
+
+    template <class _Ty, class _Receiver>
+    struct __next_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__on_next(false);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__on_next(true);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __operation<_Ty, _Receiver>* __op_;
+    };
+
+    //
+    // Resumes the coroutine, and emits every value that it yields. The
+    // coroutine stays suspended at the co_yield until the next-sender of the
+    // item has completed. If the next-sender completes before it has been
+    // started completely, the coroutine continues inline instead of being
+    // resumed from within the start, so a consumer that completes right away
+    // does not grow the stack.
+    //
+    template <class _Ty, class _Receiver>
+    struct __operation : __consumer {
+      using __handle_t = __std::coroutine_handle<__promise<_Ty>>;
+      using __next_sender_t = next_sender_of_t<_Receiver, __item_sender<_Ty>>;
+      using __next_receiver_t = __next_receiver<_Ty, _Receiver>;
+      using __callback_t =
+        stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>>, __forward_stop_request>;
+
+      __operation(__handle_t __coro, _Receiver&& __rcvr) noexcept
+        : __consumer{&__emit, &__complete, &__stopped, {}}
+        , __coro_{__coro}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      __operation(__operation&&) = delete;
+
+      ~__operation() {
+        __coro_.destroy();
+      }
+
+      void start() & noexcept {
+        __on_stop_.emplace(
+          get_stop_token(STDEXEC::get_env(__rcvr_)), __forward_stop_request{__stop_source_});
+        this->__stop_token_ = __stop_source_.get_token();
+        __coro_.promise().__consumer_ = this;
+        __coro_.resume();
+      }
+
+      static auto __emit(__consumer* __cons) noexcept -> bool {
+        auto* __self = static_cast<__operation*>(__cons);
+        if (__self->__stop_source_.stop_requested()) {
+          __self->__finish();
+          return true;
+        }
+        __self->__next_stopped_ = false;
+        __self->__inline_.store(false, std::memory_order_relaxed);
+        STDEXEC_TRY {
+          STDEXEC::start(__self->__next_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__self->__rcvr_, __item_sender<_Ty>{__self->__coro_.promise().__value_}),
+            __next_receiver_t{__self}));
+        }
+        STDEXEC_CATCH_ALL {
+          __self->__on_stop_.reset();
+          STDEXEC::set_error(static_cast<_Receiver&&>(__self->__rcvr_), std::current_exception());
+          return true;
+        }
+        if (!__self->__inline_.exchange(true, std::memory_order_acq_rel)) {
+          // __on_next resumes the coroutine once the next-sender completes.
+          return true;
+        }
+        if (__self->__next_stopped_) {
+          __self->__finish();
+          return true;
+        }
+        return false;
+      }
+
+      void __on_next(bool __stopped) noexcept {
+        __next_stopped_ = __stopped;
+        if (!__inline_.exchange(true, std::memory_order_acq_rel)) {
+          // Still inside __emit, which continues the coroutine.
+          return;
+        }
+        if (__stopped) {
+          __finish();
+        } else {
+          __coro_.resume();
+        }
+      }
+
+      static void __complete(__consumer* __cons) noexcept {
+        auto* __self = static_cast<__operation*>(__cons);
+        __self->__on_stop_.reset();
+        if (auto& __error = __self->__coro_.promise().__error_) {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(__self->__rcvr_), static_cast<std::exception_ptr&&>(__error));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__self->__rcvr_));
+        }
+      }
+
+      static void __stopped(__consumer* __cons) noexcept {
+        auto* __self = static_cast<__operation*>(__cons);
+        __self->__on_stop_.reset();
+        STDEXEC::set_stopped(static_cast<_Receiver&&>(__self->__rcvr_));
+      }
+
+      // The consumer, or a stop request, ended the sequence before the
+      // coroutine did. The coroutine is destroyed at its co_yield.
+      void __finish() noexcept {
+        __on_stop_.reset();
+        exec::__set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+      }
+
+      __handle_t __coro_;
+      _Receiver __rcvr_;
+      inplace_stop_source __stop_source_;
+      __optional<__callback_t> __on_stop_;
+      std::atomic<bool> __inline_{false};
+      bool __next_stopped_ = false;
+      __optional<connect_result_t<__next_sender_t, __next_receiver_t>> __next_op_;
+    };
+  } // namespace __async_generator
+
+  //
+  // A coroutine that produces a sequence: every `co_yield value` emits an item
+  // that sends the value, and the sequence completes when the coroutine
+  // returns. The coroutine stays suspended until the next-sender of the item
+  // has completed, so a slow consumer holds back the producer.
+  //
+  // The coroutine starts when the generator is subscribed to, and may
+  // co_await senders, which see the stop token of the subscriber. The frame
+  // is allocated once, with the allocator passed as `std::allocator_arg,
+  // alloc`, if any, and nothing is allocated per item. A yielded rvalue is
+  // sent without being moved; a yielded lvalue is copied into the frame
+  // first.
+  //
+  // An exception that escapes the coroutine is sent as set_error, and a
+  // co_await-ed sender that completes with set_stopped() stops the sequence.
+  // If the consumer stops the sequence early, the coroutine is destroyed at
+  // its co_yield.
+  //
+  template <class _Ty>
+  class [[nodiscard]] async_generator {
+    static_assert(
+      std::is_object_v<_Ty> && !std::is_const_v<_Ty>,
+      "async_generator<T> yields values of a non-const object type T");
+
+   public:
+    using promise_type = __async_generator::__promise<_Ty>;
+    using sender_concept = sequence_sender_t;
+    using item_types = exec::item_types<__async_generator::__item_sender<_Ty>>;
+    using completion_signatures = STDEXEC::completion_signatures<
+      STDEXEC::set_value_t(),
+      STDEXEC::set_error_t(std::exception_ptr),
+      STDEXEC::set_stopped_t()
+    >;
+
+    async_generator(async_generator&& __that) noexcept
+      : __coro_{std::exchange(__that.__coro_, {})} {
+    }
+
+    ~async_generator() {
+      if (__coro_) {
+        __coro_.destroy();
+      }
+    }
+
+    template <sequence_receiver_of<item_types> _Receiver>
+    auto subscribe(_Receiver __rcvr) && noexcept
+      -> __async_generator::__operation<_Ty, _Receiver> {
+      return {std::exchange(__coro_, {}), static_cast<_Receiver&&>(__rcvr)};
+    }
+
+   private:
+    friend promise_type;
+
+    explicit async_generator(STDEXEC::__std::coroutine_handle<promise_type> __coro) noexcept
+      : __coro_{__coro} {
+    }
+
+    STDEXEC::__std::coroutine_handle<promise_type> __coro_;
+  };
+} // namespace exec
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+#include "../timed_scheduler.hpp"
+#include "../variant_sender.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "./__detail/__buffered.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  struct _BATCH_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_ { };
+
+  namespace __batch {
+    using namespace STDEXEC;
+
+    template <class _Scheduler>
+    struct __params {
+      _Scheduler __sched_;
+      std::size_t __max_size_;
+      duration_of_t<_Scheduler> __timeout_;
+    };
+
+    template <class _Value>
+    using __batch_sender_t = __call_result_t<just_t, std::vector<_Value>>;
+
+    using __buffered::__value_of_t;
+
+    //
+    // The items are collected into a buffer, and the buffer is emitted as a
+    // single item when it holds __max_size_ values. A timer loop, which runs
+    // while the buffer is not empty, emits the buffer when its oldest value
+    // has waited for __timeout_. Once the input sequence has completed, the
+    // timer loop emits what is left and completes the operation.
+    //
+    template <class _Receiver, class _Value, class _Scheduler>
+    struct __operation_base
+      : __buffered::__timer_loop<
+          __operation_base<_Receiver, _Value, _Scheduler>,
+          _Receiver,
+          _Scheduler,
+          std::vector<_Value>
+        > {
+      using __base_t = __buffered::__timer_loop<
+        __operation_base,
+        _Receiver,
+        _Scheduler,
+        std::vector<_Value>
+      >;
+      using __value_t = _Value;
+      using typename __base_t::__duration_t;
+      using __push_result_t = variant_sender<
+        __call_result_t<just_t>,
+        __call_result_t<just_stopped_t>,
+        typename __base_t::__next_sender_t
+      >;
+
+      __operation_base(_Receiver __rcvr, __params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<_Scheduler&&>(__prms.__sched_)}
+        , __max_size_{__prms.__max_size_}
+        , __timeout_{__prms.__timeout_} {
+      }
+
+      auto __push(_Value __value) -> __push_result_t {
+        std::vector<_Value> __full;
+        bool __start_timer = false;
+        {
+          std::scoped_lock __lock{this->__mutex_};
+          if (this->__broken_) {
+            return just_stopped();
+          }
+          if (__buffer_.capacity() == 0) {
+            __buffer_.reserve(__max_size_);
+          }
+          __buffer_.push_back(static_cast<_Value&&>(__value));
+          if (__buffer_.size() >= __max_size_) {
+            __full = std::exchange(__buffer_, {});
+          } else if (__buffer_.size() == 1) {
+            __deadline_ = exec::now(this->__sched_) + __timeout_;
+            __start_timer = this->__activate();
+          }
+        }
+        if (__start_timer) {
+          this->__arm_timer(__timeout_);
+        }
+        if (!__full.empty()) {
+          return exec::set_next(this->__rcvr_, just(static_cast<std::vector<_Value>&&>(__full)));
+        }
+        return just();
+      }
+
+      // Called by the timer loop with the lock held.
+      auto __poll(__optional<std::vector<_Value>>& __full, __duration_t& __wait)
+        -> __buffered::__action_t {
+        if (this->__broken_) {
+          __buffer_.clear();
+        }
+        if (__buffer_.empty()) {
+          return __buffered::__action_t::__idle;
+        }
+        auto __now = exec::now(this->__sched_);
+        if (this->__done_ || __now >= __deadline_) {
+          __full.emplace(std::exchange(__buffer_, {}));
+          return __buffered::__action_t::__flush;
+        }
+        __wait = __deadline_ - __now;
+        return __buffered::__action_t::__arm;
+      }
+
+      std::size_t __max_size_;
+      __duration_t __timeout_;
+      std::vector<_Value> __buffer_;
+      time_point_of_t<_Scheduler> __deadline_{};
+    };
+
+    template <class _Sequence, class _Receiver, class _Scheduler>
+    struct __operation
+      : __operation_base<_Receiver, __value_of_t<_Sequence, env_of_t<_Receiver>>, _Scheduler> {
+      using __value_t = __value_of_t<_Sequence, env_of_t<_Receiver>>;
+      using __base_t = __operation_base<_Receiver, __value_t, _Scheduler>;
+      using __receiver_t = __buffered::__receiver<__base_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, __params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<__params<_Scheduler>&&>(__prms)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Scheduler, class _Sequence>
+      auto operator()(__ignore, __params<_Scheduler> __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Scheduler> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<__params<_Scheduler>&&>(__prms)};
+      }
+    };
+
+    //
+    // batch is a sequence adaptor that groups the values of the items of a
+    // sequence into std::vectors of up to max_size values. A batch is
+    // emitted as soon as it is full, or when its oldest value has waited for
+    // timeout on the given timed scheduler. The remaining values are emitted
+    // when the input sequence completes.
+    //
+    // The next-sender of an item that fills a batch completes only when the
+    // downstream next-sender of that batch completes, so a slow consumer
+    // holds back the producer.
+    //
+    // The first error of an item or of the input sequence is stored, stops
+    // the producer, and is delivered as set_error(std::exception_ptr) once all
+    // pending batches have completed. Values that are still buffered at that
+    // point are discarded.
+    //
+    struct batch_t {
+      template <sender _Sequence, timed_scheduler _Scheduler>
+      auto operator()(
+        _Sequence&& __sndr,
+        _Scheduler __sched,
+        std::size_t __max_size,
+        duration_of_t<_Scheduler> __timeout) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        STDEXEC_ASSERT(__max_size != 0);
+        return make_sequence_expr<batch_t>(
+          __params<_Scheduler>{static_cast<_Scheduler&&>(__sched), __max_size, __timeout},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(
+        _Scheduler __sched,
+        std::size_t __max_size,
+        duration_of_t<_Scheduler> __timeout) const noexcept {
+        return __closure(*this, static_cast<_Scheduler&&>(__sched), __max_size, __timeout);
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, batch_t>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, batch_t>);
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _ItemSender>() {
+              return __mtype<__minvoke<__buffered::__item_value_fn<_Env...>, _ItemSender>>();
+            },
+            []<class... _Values>(__mtype<_Values>...) {
+              using __values_t = __minvoke<__munique<__q<__mlist>>, _Values...>;
+              if constexpr (__mapply<__msize, __values_t>::value == 0) {
+                return item_types<>();
+              } else if constexpr (__mapply<__msize, __values_t>::value == 1) {
+                return item_types<__batch_sender_t<__mapply<__q<__msingle>, __values_t>>>();
+              } else {
+                return exec::__invalid_item_types<
+                  _BATCH_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_,
+                  _WITH_PRETTY_SEQUENCE_<__child_of<_Self>>,
+                  __fn_t<_WITH_ENVIRONMENT_, _Env>...
+                >();
+              }
+            });
+        }
+      }
+
+      template <sender_expr_for<batch_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<batch_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __batch
+
+  using __batch::batch_t;
+  inline constexpr batch_t batch{};
+} // namespace exec
@@ -0,0 +1,592 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__optional.hpp"
+#include "../../stdexec/__detail/__transform_completion_signatures.hpp"
+#include "../../stdexec/execution.hpp"
+#include "../../stdexec/stop_token.hpp"
+#include "../env.hpp"
+#include "../sequence_senders.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  namespace __bulk_each {
+    using namespace STDEXEC;
+
+    template <class _Scheduler, class _Shape, class _Fn>
+    struct __params {
+      _Scheduler __sched_;
+      _Shape __shape_;
+      _Fn __fn_;
+    };
+
+    // The decayed values of an item, which must complete with a single set of
+    // values.
+    template <class _Item, class... _Env>
+    using __item_values_t = __value_types_t<
+      __completion_signatures_of_t<_Item, _Env...>,
+      __qq<__decayed_std_tuple>,
+      __q<__msingle>
+    >;
+
+    // Splits [0, __n) into __size chunks whose lengths differ by at most one
+    // and returns the chunk of __rank.
+    template <class _Shape>
+    constexpr auto __chunk(_Shape __n, std::size_t __rank, std::size_t __size) noexcept
+      -> std::pair<_Shape, _Shape> {
+      using __ushape_t = std::make_unsigned_t<_Shape>;
+      const auto __small = static_cast<__ushape_t>(__n) / __size;
+      const auto __big_shares = static_cast<__ushape_t>(__n) % __size;
+      const auto __begin = __rank < __big_shares
+                           ? (__small + 1) * __rank
+                           : (__small + 1) * __big_shares + (__rank - __big_shares) * __small;
+      const auto __end = __begin + (__rank < __big_shares ? __small + 1 : __small);
+      return {static_cast<_Shape>(__begin), static_cast<_Shape>(__end)};
+    }
+
+    // The bulk work of one item. A crew calls __execute once per agent, and
+    // __finish once all agents are done. The agents see the stop token of the
+    // receiver of the item through __stop_token.
+    struct __job {
+      virtual void __execute(std::size_t __agent, std::size_t __num_agents) = 0;
+      virtual void __finish(std::exception_ptr __error, bool __stopped) noexcept = 0;
+      virtual auto __stop_token() const noexcept -> inplace_stop_token = 0;
+
+     protected:
+      ~__job() = default;
+    };
+
+    template <class _Scheduler>
+    struct __crews;
+
+    template <class _Crew>
+    struct __agent_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        STDEXEC_TRY {
+          __crew_->__job_->__execute(__index_, __crew_->__num_agents_);
+        }
+        STDEXEC_CATCH_ALL {
+          __crew_->__fail(std::current_exception());
+        }
+        __crew_->__arrive();
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+          __crew_->__fail(static_cast<_Error&&>(__error));
+        } else {
+          __crew_->__fail(std::make_exception_ptr(static_cast<_Error&&>(__error)));
+        }
+        __crew_->__arrive();
+      }
+
+      void set_stopped() noexcept {
+        __crew_->__stopped_.store(true, std::memory_order_relaxed);
+        __crew_->__arrive();
+      }
+
+      [[nodiscard]]
+      auto get_env() const noexcept -> prop<get_stop_token_t, inplace_stop_token> {
+        return prop{get_stop_token, __crew_->__job_->__stop_token()};
+      }
+
+      _Crew* __crew_;
+      std::size_t __index_;
+    };
+
+    // A crew owns one schedule operation per agent. The operations are
+    // re-emplaced in place for every item, so that running the bulk work of an
+    // item does not allocate once the crew exists.
+    template <class _Scheduler>
+    struct __crew {
+      using __agent_op_t =
+        connect_result_t<schedule_result_t<_Scheduler&>, __agent_receiver<__crew>>;
+
+      __crew(__crews<_Scheduler>* __owner, std::size_t __num_agents)
+        : __owner_{__owner}
+        , __num_agents_{__num_agents}
+        , __agents_{std::make_unique<__optional<__agent_op_t>[]>(__num_agents)} {
+      }
+
+      void __launch(__job* __job) noexcept {
+        __job_ = __job;
+        __error_ = nullptr;
+        __failed_.store(false, std::memory_order_relaxed);
+        __stopped_.store(false, std::memory_order_relaxed);
+        __remaining_.store(__num_agents_, std::memory_order_relaxed);
+        // Once the last agent has started, the crew may already have been
+        // released and launched for another item, so the loop bound is a copy.
+        const std::size_t __num_agents = __num_agents_;
+        auto* __agents = __agents_.get();
+        for (std::size_t __i = 0; __i < __num_agents; ++__i) {
+          STDEXEC_TRY {
+            STDEXEC::start(__agents[__i].__emplace_from(
+              STDEXEC::connect,
+              STDEXEC::schedule(__owner_->__sched_),
+              __agent_receiver<__crew>{this, __i}));
+          }
+          STDEXEC_CATCH_ALL {
+            __fail(std::current_exception());
+            __arrive();
+          }
+        }
+      }
+
+      void __fail(std::exception_ptr __error) noexcept {
+        if (!__failed_.exchange(true, std::memory_order_relaxed)) {
+          __error_ = static_cast<std::exception_ptr&&>(__error);
+        }
+      }
+
+      // Called once by every agent. The last one hands the crew back to its
+      // owner before it completes the job.
+      void __arrive() noexcept {
+        if (__remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          auto* __job = __job_;
+          auto __error = static_cast<std::exception_ptr&&>(__error_);
+          bool __stopped = __stopped_.load(std::memory_order_relaxed);
+          __owner_->__release(this);
+          __job->__finish(static_cast<std::exception_ptr&&>(__error), __stopped);
+        }
+      }
+
+      __crews<_Scheduler>* __owner_;
+      std::size_t __num_agents_;
+      std::unique_ptr<__optional<__agent_op_t>[]> __agents_;
+      __job* __job_ = nullptr;
+      std::atomic<std::size_t> __remaining_{0};
+      std::atomic<bool> __failed_{false};
+      std::atomic<bool> __stopped_{false};
+      std::exception_ptr __error_;
+      __crew* __next_ = nullptr;
+    };
+
+    // The crews of one bulk_each operation. A crew is created when an item
+    // needs one and none is idle, so there are as many crews as items whose
+    // bulk work overlaps, which is one for a sequence that emits its items one
+    // after the other.
+    template <class _Scheduler>
+    struct __crews {
+      __crews(std::size_t __num_agents, _Scheduler __sched)
+        : __sched_{static_cast<_Scheduler&&>(__sched)}
+        , __num_agents_{__num_agents} {
+      }
+
+      auto __acquire() -> __crew<_Scheduler>* {
+        std::scoped_lock __lock{__mutex_};
+        if (auto* __idle = __idle_) {
+          __idle_ = std::exchange(__idle->__next_, nullptr);
+          return __idle;
+        }
+        auto __new = std::make_unique<__crew<_Scheduler>>(this, __num_agents_);
+        return __all_.emplace_back(static_cast<std::unique_ptr<__crew<_Scheduler>>&&>(__new)).get();
+      }
+
+      void __release(__crew<_Scheduler>* __done) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __done->__next_ = std::exchange(__idle_, __done);
+      }
+
+      _Scheduler __sched_;
+      std::size_t __num_agents_;
+      std::mutex __mutex_;
+      __crew<_Scheduler>* __idle_ = nullptr;
+      std::vector<std::unique_ptr<__crew<_Scheduler>>> __all_;
+    };
+
+    template <class _Scheduler, class _Shape, class _Fn>
+    struct __shared : __crews<_Scheduler> {
+      explicit __shared(__params<_Scheduler, _Shape, _Fn> __prms)
+        : __crews<_Scheduler>{
+            __agents_for(__prms.__sched_, __prms.__shape_),
+            static_cast<_Scheduler&&>(__prms.__sched_)}
+        , __shape_{__prms.__shape_}
+        , __fn_{static_cast<_Fn&&>(__prms.__fn_)} {
+      }
+
+      static auto __agents_for(const _Scheduler& __sched, _Shape __shape) noexcept -> std::size_t {
+        std::size_t __parallelism = 0;
+        if constexpr (__queryable_with<const _Scheduler, get_available_parallelism_t>) {
+          __parallelism = get_available_parallelism(__sched);
+        } else {
+          __parallelism = std::thread::hardware_concurrency();
+        }
+        __parallelism = (std::max) (__parallelism, std::size_t{1});
+        return (std::min) (static_cast<std::size_t>(__shape), __parallelism);
+      }
+
+      _Shape __shape_;
+      _Fn __fn_;
+    };
+
+    template <class _Operation>
+    struct __value_receiver {
+      using receiver_concept = receiver_t;
+
+      template <class... _Values>
+      void set_value(_Values&&... __values) noexcept {
+        __op_->__on_values(static_cast<_Values&&>(__values)...);
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        STDEXEC::set_error(
+          static_cast<_Operation::__receiver_t&&>(__op_->__rcvr_), static_cast<_Error&&>(__error));
+      }
+
+      void set_stopped() noexcept {
+        STDEXEC::set_stopped(static_cast<_Operation::__receiver_t&&>(__op_->__rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _Operation::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _Operation* __op_;
+    };
+
+    // Hands the stop token of the receiver of an item to its agents as an
+    // inplace_stop_token. Other stoppable tokens are forwarded to a stop
+    // source while the agents run.
+    template <class _Token>
+    struct __stop_adaptor {
+      void __attach(_Token __token) {
+        __on_stop_.emplace(static_cast<_Token&&>(__token), __forward_stop_request{__source_});
+      }
+
+      void __detach() noexcept {
+        __on_stop_.reset();
+      }
+
+      auto __get_token() const noexcept -> inplace_stop_token {
+        return __source_.get_token();
+      }
+
+      inplace_stop_source __source_;
+      __optional<stop_callback_for_t<_Token, __forward_stop_request>> __on_stop_;
+    };
+
+    template <class _Token>
+      requires unstoppable_token<_Token>
+    struct __stop_adaptor<_Token> {
+      void __attach(_Token) noexcept {
+      }
+
+      void __detach() noexcept {
+      }
+
+      auto __get_token() const noexcept -> inplace_stop_token {
+        return {};
+      }
+    };
+
+    template <>
+    struct __stop_adaptor<inplace_stop_token> {
+      void __attach(inplace_stop_token __token) noexcept {
+        __token_ = __token;
+      }
+
+      void __detach() noexcept {
+      }
+
+      auto __get_token() const noexcept -> inplace_stop_token {
+        return __token_;
+      }
+
+      inplace_stop_token __token_;
+    };
+
+    // Runs an item, and then the bulk function on its values with a crew of
+    // the bulk_each operation. The values are sent on once all agents are
+    // done.
+    template <class _Item, class _Shared, class _Receiver>
+    struct __item_operation : __job {
+      using __receiver_t = _Receiver;
+      using __values_t = __item_values_t<_Item, env_of_t<_Receiver>>;
+      using __value_receiver_t = __value_receiver<__item_operation>;
+
+      __item_operation(_Item&& __item, _Shared* __shared, _Receiver __rcvr)
+        : __shared_{__shared}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __item_op_{STDEXEC::connect(static_cast<_Item&&>(__item), __value_receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__item_op_);
+      }
+
+      template <class... _Values>
+      void __on_values(_Values&&... __values) noexcept {
+        STDEXEC_TRY {
+          __values_.emplace(static_cast<_Values&&>(__values)...);
+          if (__shared_->__num_agents_ == 0) {
+            __finish(nullptr, false);
+          } else {
+            __stop_.__attach(get_stop_token(STDEXEC::get_env(__rcvr_)));
+            __shared_->__acquire()->__launch(this);
+          }
+        }
+        STDEXEC_CATCH_ALL {
+          STDEXEC::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+        }
+      }
+
+      void __execute(std::size_t __agent, std::size_t __num_agents) final {
+        auto [__begin, __end] = __chunk(__shared_->__shape_, __agent, __num_agents);
+        std::apply(
+          [&](auto&... __values) {
+            for (auto __i = __begin; __i != __end; ++__i) {
+              __shared_->__fn_(__i, __values...);
+            }
+          },
+          *__values_);
+      }
+
+      void __finish(std::exception_ptr __error, bool __stopped) noexcept final {
+        __stop_.__detach();
+        if (__error) {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(__rcvr_), static_cast<std::exception_ptr&&>(__error));
+        } else if (__stopped) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else {
+          std::apply(
+            [this](auto&... __values) {
+              STDEXEC::set_value(
+                static_cast<_Receiver&&>(__rcvr_), static_cast<decltype(__values)&&>(__values)...);
+            },
+            *__values_);
+        }
+      }
+
+      auto __stop_token() const noexcept -> inplace_stop_token final {
+        return __stop_.__get_token();
+      }
+
+      _Shared* __shared_;
+      _Receiver __rcvr_;
+      __stop_adaptor<stop_token_of_t<env_of_t<_Receiver>>> __stop_;
+      __optional<__values_t> __values_;
+      connect_result_t<_Item, __value_receiver_t> __item_op_;
+    };
+
+    template <class... _Values>
+    using __decayed_value_sig = completion_signatures<set_value_t(__decay_t<_Values>...)>;
+
+    // The item that bulk_each emits for each item of its input.
+    template <class _Item, class _Shared>
+    struct __item_sender {
+      using sender_concept = sender_t;
+
+      template <class... _Env>
+      using __completions_t = STDEXEC::transform_completion_signatures<
+        __completion_signatures_of_t<_Item, _Env...>,
+        completion_signatures<set_error_t(std::exception_ptr), set_stopped_t()>,
+        __decayed_value_sig
+      >;
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() -> __completions_t<_Env...> {
+        return {};
+      }
+
+      template <receiver _Receiver>
+      auto connect(_Receiver __rcvr) && -> __item_operation<_Item, _Shared, _Receiver> {
+        return {static_cast<_Item&&>(__item_), __shared_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      _Shared* __shared_;
+      _Item __item_;
+    };
+
+    template <class _Receiver, class _Shared>
+    struct __operation_base {
+      _Receiver __rcvr_;
+      _Shared __shared_;
+    };
+
+    template <class _Receiver, class _Shared>
+    struct __receiver {
+      using receiver_concept = receiver_t;
+
+      template <class _Item>
+      auto set_next(_Item&& __item) & noexcept(
+        __nothrow_callable<set_next_t, _Receiver&, __item_sender<__decay_t<_Item>, _Shared>>
+        && __nothrow_decay_copyable<_Item>)
+        -> next_sender_of_t<_Receiver, __item_sender<__decay_t<_Item>, _Shared>> {
+        return exec::set_next(
+          __op_->__rcvr_,
+          __item_sender<__decay_t<_Item>, _Shared>{
+            &__op_->__shared_, static_cast<_Item&&>(__item)});
+      }
+
+      void set_value() noexcept {
+        STDEXEC::set_value(static_cast<_Receiver&&>(__op_->__rcvr_));
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        STDEXEC::set_error(
+          static_cast<_Receiver&&>(__op_->__rcvr_), static_cast<_Error&&>(__error));
+      }
+
+      void set_stopped() noexcept
+        requires __callable<set_stopped_t, _Receiver>
+      {
+        STDEXEC::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __operation_base<_Receiver, _Shared>* __op_;
+    };
+
+    template <class _Sequence, class _Receiver, class _Scheduler, class _Shape, class _Fn>
+    struct __operation : __operation_base<_Receiver, __shared<_Scheduler, _Shape, _Fn>> {
+      using __shared_t = __shared<_Scheduler, _Shape, _Fn>;
+      using __receiver_t = __receiver<_Receiver, __shared_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, __params<_Scheduler, _Shape, _Fn> __prms)
+        : __operation_base<_Receiver, __shared_t>{
+            static_cast<_Receiver&&>(__rcvr),
+            __shared_t{static_cast<__params<_Scheduler, _Shape, _Fn>&&>(__prms)}}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Scheduler, class _Shape, class _Fn, class _Sequence>
+      auto operator()(__ignore, __params<_Scheduler, _Shape, _Fn> __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Scheduler, _Shape, _Fn> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<__params<_Scheduler, _Shape, _Fn>&&>(__prms)};
+      }
+    };
+
+    //
+    // bulk_each is a sequence adaptor that runs fn(i, values...) for every i
+    // in [0, shape) on sched for the values of each item, like
+    // transform_each(continues_on(sched) | bulk(par, shape, fn)) does, and
+    // emits items that send the decayed values once all calls are done.
+    //
+    // The work is split between min(shape, parallelism) agents, where the
+    // parallelism is what sched answers to get_available_parallelism, or
+    // hardware_concurrency() if it does not answer it. The agents see the stop
+    // token of the receiver of the item. Their schedule operations are
+    // allocated once per crew, and a crew is reused by the following items, so
+    // that the per-item cost is that of starting the agents, and not of
+    // allocating their state. Items whose bulk work overlaps use separate
+    // crews.
+    //
+    // The first exception that fn throws is sent as set_error once all agents
+    // are done. Items must complete with a single set of values.
+    //
+    struct bulk_each_t {
+      template <sender _Sequence, scheduler _Scheduler, std::integral _Shape, class _Fn>
+      auto operator()(_Sequence&& __sndr, _Scheduler __sched, _Shape __shape, _Fn __fn) const
+        -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<bulk_each_t>(
+          __params<_Scheduler, _Shape, _Fn>{
+            static_cast<_Scheduler&&>(__sched), __shape, static_cast<_Fn&&>(__fn)},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <scheduler _Scheduler, std::integral _Shape, class _Fn>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(_Scheduler __sched, _Shape __shape, _Fn __fn) const {
+        return __closure(
+          *this, static_cast<_Scheduler&&>(__sched), __shape, static_cast<_Fn&&>(__fn));
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, bulk_each_t>);
+        return exec::__sequence_completion_signatures_of<__child_of<_Self>, _Env...>();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, bulk_each_t>);
+        using __params_t = __decay_t<__data_of<_Self>>;
+        using __shared_t = __shared<
+          decltype(__params_t::__sched_),
+          decltype(__params_t::__shape_),
+          decltype(__params_t::__fn_)
+        >;
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _Item>() { return __mtype<__item_sender<__decay_t<_Item>, __shared_t>>(); },
+            []<class... _Items>(__mtype<_Items>...) {
+              return __minvoke<__munique<__qq<item_types>>, _Items...>();
+            });
+        }
+      }
+
+      template <sender_expr_for<bulk_each_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<bulk_each_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __bulk_each
+
+  using __bulk_each::bulk_each_t;
+  inline constexpr bulk_each_t bulk_each{};
+} // namespace exec
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__optional.hpp"
+#include "../../stdexec/execution.hpp"
+
+#include "../sequence.hpp"
+#include "../sequence_senders.hpp"
+#include "../trampoline_scheduler.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace exec {
+  template <class _Ty>
+  class channel;
+
+  namespace __chan {
+    using namespace STDEXEC;
+
+    // An operation that waits in one of the queues of a channel. __complete_
+    // is called without the lock held once the operation has been dequeued.
+    struct __waiter {
+      void (*__complete_)(__waiter*) noexcept;
+      __waiter* __prev_ = nullptr;
+      __waiter* __next_ = nullptr;
+      bool __queued_ = false;
+    };
+
+    // A FIFO of waiters that supports removing an arbitrary waiter, which is
+    // needed when a waiting operation is cancelled.
+    struct __waiter_list {
+      [[nodiscard]]
+      auto empty() const noexcept -> bool {
+        return __head_ == nullptr;
+      }
+
+      void push_back(__waiter* __w) noexcept {
+        __w->__queued_ = true;
+        __w->__next_ = nullptr;
+        __w->__prev_ = __tail_;
+        if (__tail_ != nullptr) {
+          __tail_->__next_ = __w;
+        } else {
+          __head_ = __w;
+        }
+        __tail_ = __w;
+      }
+
+      auto pop_front() noexcept -> __waiter* {
+        __waiter* __w = __head_;
+        __head_ = __w->__next_;
+        if (__head_ != nullptr) {
+          __head_->__prev_ = nullptr;
+        } else {
+          __tail_ = nullptr;
+        }
+        __w->__queued_ = false;
+        __w->__next_ = nullptr;
+        return __w;
+      }
+
+      // Returns false if __w is not in the list.
+      auto remove(__waiter* __w) noexcept -> bool {
+        if (!__w->__queued_) {
+          return false;
+        }
+        __w->__queued_ = false;
+        if (__w->__prev_ != nullptr) {
+          __w->__prev_->__next_ = __w->__next_;
+        } else {
+          __head_ = __w->__next_;
+        }
+        if (__w->__next_ != nullptr) {
+          __w->__next_->__prev_ = __w->__prev_;
+        } else {
+          __tail_ = __w->__prev_;
+        }
+        __w->__prev_ = nullptr;
+        __w->__next_ = nullptr;
+        return true;
+      }
+
+      // Takes all waiters out of the list at once and returns the first one.
+      // They stay linked through __next_, so that they can be completed after
+      // the lock has been released, but remove() no longer finds them.
+      auto release_all() noexcept -> __waiter* {
+        for (__waiter* __w = __head_; __w != nullptr; __w = __w->__next_) {
+          __w->__queued_ = false;
+        }
+        __tail_ = nullptr;
+        return std::exchange(__head_, nullptr);
+      }
+
+      // Completes the waiters returned by release_all().
+      static void complete_all(__waiter* __w) noexcept {
+        while (__w != nullptr) {
+          // __complete_ may destroy the waiter.
+          __waiter* __next = __w->__next_;
+          __w->__complete_(__w);
+          __w = __next;
+        }
+      }
+
+      __waiter* __head_ = nullptr;
+      __waiter* __tail_ = nullptr;
+    };
+
+    template <class _Ty>
+    struct __send_waiter : __waiter {
+      _Ty __value_;
+      bool __delivered_ = false;
+    };
+
+    template <class _Ty>
+    struct __receive_waiter : __waiter {
+      __optional<_Ty> __value_;
+    };
+
+    template <class _Ty>
+    struct __state {
+      explicit __state(std::size_t __capacity)
+        : __capacity_{__capacity}
+        , __buffer_{__capacity == 0 ? nullptr : std::make_unique<__optional<_Ty>[]>(__capacity)} {
+      }
+
+      // Must be called with the lock held and __size_ < __capacity_.
+      void __push(_Ty&& __value) noexcept(__nothrow_move_constructible<_Ty>) {
+        __buffer_[(__head_ + __size_) % __capacity_].emplace(static_cast<_Ty&&>(__value));
+        ++__size_;
+      }
+
+      // Must be called with the lock held and __size_ > 0.
+      auto __pop() noexcept(__nothrow_move_constructible<_Ty>) -> _Ty {
+        auto& __slot = __buffer_[__head_];
+        _Ty __value = static_cast<_Ty&&>(*__slot);
+        __slot.reset();
+        __head_ = (__head_ + 1) % __capacity_;
+        --__size_;
+        return __value;
+      }
+
+      std::mutex __mutex_;
+      const std::size_t __capacity_;
+      std::unique_ptr<__optional<_Ty>[]> __buffer_;
+      std::size_t __head_ = 0;
+      std::size_t __size_ = 0;
+      bool __closed_ = false;
+      __waiter_list __senders_;
+      __waiter_list __receivers_;
+    };
+
+    template <class _Ty, class _Receiver>
+    struct __send_operation : __send_waiter<_Ty> {
+      struct __on_stop {
+        void operator()() const noexcept {
+          __self_->__request_stop();
+        }
+
+        __send_operation* __self_;
+      };
+
+      using __callback_t = stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>>, __on_stop>;
+
+      __send_operation(__state<_Ty>* __state, _Ty&& __value, _Receiver&& __rcvr)
+        : __send_waiter<_Ty>{{&__complete}, static_cast<_Ty&&>(__value)}
+        , __state_{__state}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      void start() & noexcept {
+        // The callback is registered before the operation can be enqueued, so
+        // that it is never emplaced concurrently with __complete.
+        __on_stop_.emplace(get_stop_token(STDEXEC::get_env(__rcvr_)), __on_stop{this});
+        std::unique_lock __lock{__state_->__mutex_};
+        if (__state_->__closed_ || get_stop_token(STDEXEC::get_env(__rcvr_)).stop_requested()) {
+          __lock.unlock();
+          __on_stop_.reset();
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else if (!__state_->__receivers_.empty()) {
+          auto* __rcv = static_cast<__receive_waiter<_Ty>*>(__state_->__receivers_.pop_front());
+          __rcv->__value_.emplace(static_cast<_Ty&&>(this->__value_));
+          __lock.unlock();
+          __rcv->__complete_(__rcv);
+          __on_stop_.reset();
+          STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+        } else if (__state_->__size_ < __state_->__capacity_) {
+          __state_->__push(static_cast<_Ty&&>(this->__value_));
+          __lock.unlock();
+          __on_stop_.reset();
+          STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+        } else {
+          // The channel is full. A receiver that makes room moves the value
+          // into the buffer and completes this operation.
+          __state_->__senders_.push_back(this);
+        }
+      }
+
+      static void __complete(__waiter* __w) noexcept {
+        auto* __self = static_cast<__send_operation*>(__w);
+        __self->__on_stop_.reset();
+        if (__self->__delivered_) {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__self->__rcvr_));
+        } else {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__self->__rcvr_));
+        }
+      }
+
+      void __request_stop() noexcept {
+        {
+          std::scoped_lock __lock{__state_->__mutex_};
+          if (!__state_->__senders_.remove(this)) {
+            return;
+          }
+        }
+        STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+      }
+
+      __state<_Ty>* __state_;
+      _Receiver __rcvr_;
+      __optional<__callback_t> __on_stop_;
+    };
+
+    template <class _Ty>
+    struct __send_sender {
+      using sender_concept = sender_t;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+
+      template <receiver_of<completion_signatures> _Receiver>
+      auto connect(_Receiver __rcvr) && noexcept(__nothrow_move_constructible<_Ty>)
+        -> __send_operation<_Ty, _Receiver> {
+        return {__state_, static_cast<_Ty&&>(__value_), static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      __state<_Ty>* __state_;
+      _Ty __value_;
+    };
+
+    template <class _Ty>
+    using __item_sender_t = __result_of<
+      exec::sequence,
+      schedule_result_t<trampoline_scheduler&>,
+      __call_result_t<just_t, _Ty>
+    >;
+
+    template <class _Ty, class _Receiver>
+    struct __receive_operation;
+
+    template <class _Ty, class _Receiver>
+    struct __next_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__receive_next();
+      }
+
+      void set_stopped() noexcept {
+        __op_->__finish();
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __receive_operation<_Ty, _Receiver>* __op_;
+    };
+
+    //
+    // Takes values out of the channel one at a time and emits each as an
+    // item of the sequence. The next value is taken only once the
+    // next-sender of the previous item has completed.
+    //
+    template <class _Ty, class _Receiver>
+    struct __receive_operation : __receive_waiter<_Ty> {
+      struct __on_stop {
+        void operator()() const noexcept {
+          __self_->__request_stop();
+        }
+
+        __receive_operation* __self_;
+      };
+
+      using __callback_t = stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>>, __on_stop>;
+      using __next_sender_t = next_sender_of_t<_Receiver, __item_sender_t<_Ty>>;
+      using __next_receiver_t = __next_receiver<_Ty, _Receiver>;
+
+      __receive_operation(__state<_Ty>* __state, _Receiver&& __rcvr)
+        : __receive_waiter<_Ty>{{&__complete}, {}}
+        , __state_{__state}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      void start() & noexcept {
+        __on_stop_.emplace(get_stop_token(STDEXEC::get_env(__rcvr_)), __on_stop{this});
+        __receive_next();
+      }
+
+      void __receive_next() noexcept {
+        std::unique_lock __lock{__state_->__mutex_};
+        if (get_stop_token(STDEXEC::get_env(__rcvr_)).stop_requested()) {
+          __lock.unlock();
+          __finish();
+          return;
+        }
+        __send_waiter<_Ty>* __sender = nullptr;
+        if (__state_->__size_ != 0) {
+          this->__value_.emplace(__state_->__pop());
+          if (!__state_->__senders_.empty()) {
+            __sender = static_cast<__send_waiter<_Ty>*>(__state_->__senders_.pop_front());
+            __state_->__push(static_cast<_Ty&&>(__sender->__value_));
+            __sender->__delivered_ = true;
+          }
+        } else if (!__state_->__senders_.empty()) {
+          __sender = static_cast<__send_waiter<_Ty>*>(__state_->__senders_.pop_front());
+          this->__value_.emplace(static_cast<_Ty&&>(__sender->__value_));
+          __sender->__delivered_ = true;
+        } else if (!__state_->__closed_) {
+          // The channel is empty. A sender or close() dequeues this operation
+          // and calls __complete.
+          __state_->__receivers_.push_back(this);
+          return;
+        }
+        __lock.unlock();
+        if (__sender != nullptr) {
+          __sender->__complete_(__sender);
+        }
+        __emit();
+      }
+
+      static void __complete(__waiter* __w) noexcept {
+        static_cast<__receive_operation*>(__w)->__emit();
+      }
+
+      // Emits the value that has been received, or completes the sequence if
+      // the channel has been closed.
+      void __emit() noexcept {
+        if (!this->__value_.has_value()) {
+          __finish();
+          return;
+        }
+        STDEXEC_TRY {
+          auto& __op = __next_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(
+              __rcvr_,
+              exec::sequence(
+                STDEXEC::schedule(__scheduler_),
+                STDEXEC::just(static_cast<_Ty&&>(*this->__value_)))),
+            __next_receiver_t{this});
+          this->__value_.reset();
+          STDEXEC::start(__op);
+        }
+        STDEXEC_CATCH_ALL {
+          __on_stop_.reset();
+          STDEXEC::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+        }
+      }
+
+      void __finish() noexcept {
+        __on_stop_.reset();
+        __set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+      }
+
+      void __request_stop() noexcept {
+        {
+          std::scoped_lock __lock{__state_->__mutex_};
+          if (!__state_->__receivers_.remove(this)) {
+            // The operation is not waiting, and will notice the stop request
+            // before it waits again.
+            return;
+          }
+        }
+        STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+      }
+
+      __state<_Ty>* __state_;
+      _Receiver __rcvr_;
+      trampoline_scheduler __scheduler_{};
+      __optional<__callback_t> __on_stop_;
+      __optional<connect_result_t<__next_sender_t, __next_receiver_t>> __next_op_;
+    };
+
+    template <class _Ty>
+    struct __receive_sequence {
+      using sender_concept = sequence_sender_t;
+      using item_types = exec::item_types<__item_sender_t<_Ty>>;
+      using completion_signatures = STDEXEC::completion_signatures<
+        set_value_t(),
+        set_error_t(std::exception_ptr),
+        set_stopped_t()
+      >;
+
+      template <sequence_receiver_of<item_types> _Receiver>
+      auto subscribe(_Receiver __rcvr) const noexcept -> __receive_operation<_Ty, _Receiver> {
+        return {__state_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      __state<_Ty>* __state_;
+    };
+  } // namespace __chan
+
+  //
+  // A bounded multi-producer multi-consumer channel.
+  //
+  // send(value) returns a sender that completes with set_value() once the
+  // value has been placed into the channel, waiting while the channel holds
+  // capacity values. It completes with set_stopped() if the channel is
+  // closed, or if stop is requested while it waits.
+  //
+  // receive() returns a sequence sender whose items are the values taken
+  // out of the channel. A value is taken only after the previous item has
+  // been consumed, and each value is delivered to exactly one of the
+  // subscribed sequences. The sequence completes once the channel is closed
+  // and empty.
+  //
+  // A capacity of 0 makes every send wait for a receiver. The channel must
+  // outlive all operations on it.
+  //
+  template <class _Ty>
+  class channel {
+   public:
+    explicit channel(std::size_t __capacity)
+      : __state_{__capacity} {
+    }
+
+    channel(channel&&) = delete;
+
+    ~channel() {
+      STDEXEC_ASSERT(__state_.__senders_.empty() && __state_.__receivers_.empty());
+    }
+
+    [[nodiscard]]
+    auto send(_Ty __value) noexcept(STDEXEC::__nothrow_move_constructible<_Ty>)
+      -> __chan::__send_sender<_Ty> {
+      return {&__state_, static_cast<_Ty&&>(__value)};
+    }
+
+    [[nodiscard]]
+    auto receive() noexcept -> __chan::__receive_sequence<_Ty> {
+      return {&__state_};
+    }
+
+    // Completes all waiting senders with set_stopped(). The values that are
+    // already in the channel can still be received.
+    void close() noexcept {
+      __chan::__waiter* __senders = nullptr;
+      __chan::__waiter* __receivers = nullptr;
+      {
+        // The waiters are dequeued with the lock held, so that a concurrent
+        // stop request does not find them and complete them a second time.
+        std::scoped_lock __lock{__state_.__mutex_};
+        __state_.__closed_ = true;
+        __senders = __state_.__senders_.release_all();
+        __receivers = __state_.__receivers_.release_all();
+      }
+      __chan::__waiter_list::complete_all(__senders);
+      __chan::__waiter_list::complete_all(__receivers);
+    }
+
+    [[nodiscard]]
+    auto capacity() const noexcept -> std::size_t {
+      return __state_.__capacity_;
+    }
+
+   private:
+    __chan::__state<_Ty> __state_;
+  };
+} // namespace exec
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+#include "../timed_scheduler.hpp"
+#include "../variant_sender.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "./__detail/__buffered.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace exec {
+  struct _DEBOUNCE_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_ { };
+
+  namespace __debounce {
+    using namespace STDEXEC;
+
+    template <class _Scheduler>
+    struct __params {
+      _Scheduler __sched_;
+      duration_of_t<_Scheduler> __quiet_;
+    };
+
+    template <class _Value>
+    using __debounce_sender_t = __call_result_t<just_t, _Value>;
+
+    using __buffered::__value_of_t;
+
+    //
+    // Only the latest value is kept, together with the time at which the
+    // input has been quiet for __quiet_. A single timer loop, which runs
+    // while a value is pending, wakes up at that deadline: it emits the value
+    // if no other value has arrived since, or sleeps until the new deadline
+    // otherwise, so that the timer is not restarted for every value. Once the
+    // input sequence has completed, the pending value is emitted right away.
+    //
+    template <class _Receiver, class _Value, class _Scheduler>
+    struct __operation_base
+      : __buffered::__timer_loop<
+          __operation_base<_Receiver, _Value, _Scheduler>,
+          _Receiver,
+          _Scheduler,
+          _Value
+        > {
+      using __base_t = __buffered::__timer_loop<__operation_base, _Receiver, _Scheduler, _Value>;
+      using __value_t = _Value;
+      using typename __base_t::__duration_t;
+      using __push_result_t =
+        variant_sender<__call_result_t<just_t>, __call_result_t<just_stopped_t>>;
+
+      __operation_base(_Receiver __rcvr, __params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<_Scheduler&&>(__prms.__sched_)}
+        , __quiet_{__prms.__quiet_} {
+      }
+
+      auto __push(_Value __value) -> __push_result_t {
+        bool __start_timer = false;
+        {
+          std::scoped_lock __lock{this->__mutex_};
+          if (this->__broken_) {
+            return just_stopped();
+          }
+          // The previous value, if any, is superseded.
+          __latest_.emplace(static_cast<_Value&&>(__value));
+          __deadline_ = exec::now(this->__sched_) + __quiet_;
+          __start_timer = this->__activate();
+        }
+        if (__start_timer) {
+          this->__arm_timer(__quiet_);
+        }
+        return just();
+      }
+
+      // Called by the timer loop with the lock held.
+      auto __poll(__optional<_Value>& __value, __duration_t& __wait) -> __buffered::__action_t {
+        if (this->__broken_) {
+          __latest_.reset();
+        }
+        if (!__latest_.has_value()) {
+          return __buffered::__action_t::__idle;
+        }
+        auto __now = exec::now(this->__sched_);
+        if (this->__done_ || __now >= __deadline_) {
+          __value.emplace(static_cast<_Value&&>(*__latest_));
+          __latest_.reset();
+          return __buffered::__action_t::__flush;
+        }
+        __wait = __deadline_ - __now;
+        return __buffered::__action_t::__arm;
+      }
+
+      __duration_t __quiet_;
+      __optional<_Value> __latest_;
+      time_point_of_t<_Scheduler> __deadline_{};
+    };
+
+    template <class _Sequence, class _Receiver, class _Scheduler>
+    struct __operation
+      : __operation_base<_Receiver, __value_of_t<_Sequence, env_of_t<_Receiver>>, _Scheduler> {
+      using __value_t = __value_of_t<_Sequence, env_of_t<_Receiver>>;
+      using __base_t = __operation_base<_Receiver, __value_t, _Scheduler>;
+      using __receiver_t = __buffered::__receiver<__base_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, __params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<__params<_Scheduler>&&>(__prms)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Scheduler, class _Sequence>
+      auto operator()(__ignore, __params<_Scheduler> __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Scheduler> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<__params<_Scheduler>&&>(__prms)};
+      }
+    };
+
+    //
+    // debounce is a sequence adaptor that emits the value of an item only
+    // once no other item has arrived for quiet on the given timed scheduler,
+    // and drops the values that are superseded within that time. The pending
+    // value is emitted when the input sequence completes.
+    //
+    // The next-senders of the input items complete right away. The timer is
+    // armed once per quiet period rather than once per item.
+    //
+    // Errors are handled as in exec::batch, and a value that is still
+    // pending when an error occurs is discarded.
+    //
+    struct debounce_t {
+      template <sender _Sequence, timed_scheduler _Scheduler>
+      auto operator()(_Sequence&& __sndr, _Scheduler __sched, duration_of_t<_Scheduler> __quiet)
+        const noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<debounce_t>(
+          __params<_Scheduler>{static_cast<_Scheduler&&>(__sched), __quiet},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(_Scheduler __sched, duration_of_t<_Scheduler> __quiet) const
+        noexcept {
+        return __closure(*this, static_cast<_Scheduler&&>(__sched), __quiet);
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, debounce_t>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, debounce_t>);
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _ItemSender>() {
+              return __mtype<__minvoke<__buffered::__item_value_fn<_Env...>, _ItemSender>>();
+            },
+            []<class... _Values>(__mtype<_Values>...) {
+              using __values_t = __minvoke<__munique<__q<__mlist>>, _Values...>;
+              if constexpr (__mapply<__msize, __values_t>::value == 0) {
+                return item_types<>();
+              } else if constexpr (__mapply<__msize, __values_t>::value == 1) {
+                return item_types<__debounce_sender_t<__mapply<__q<__msingle>, __values_t>>>();
+              } else {
+                return exec::__invalid_item_types<
+                  _DEBOUNCE_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_,
+                  _WITH_PRETTY_SEQUENCE_<__child_of<_Self>>,
+                  __fn_t<_WITH_ENVIRONMENT_, _Env>...
+                >();
+              }
+            });
+        }
+      }
+
+      template <sender_expr_for<debounce_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<debounce_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __debounce
+
+  using __debounce::debounce_t;
+  inline constexpr debounce_t debounce{};
+} // namespace exec
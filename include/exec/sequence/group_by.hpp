@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__intrusive_queue.hpp"
+#include "../../stdexec/__detail/__optional.hpp"
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "./__detail/__buffered.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace exec {
+  struct _GROUP_BY_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_ { };
+
+  namespace __group_by {
+    using namespace STDEXEC;
+
+    using __buffered::__value_of_t;
+
+    template <class _KeyFn, class _Value>
+    using __key_of_t = __decay_t<__call_result_t<_KeyFn&, const _Value&>>;
+
+    // The value of an item of the input sequence, waiting to be delivered to
+    // the subscriber of its group. __complete_ completes the next-sender of
+    // the item.
+    template <class _Value>
+    struct __delivery {
+      _Value __value_;
+      void (*__complete_)(__delivery*, bool __stopped) noexcept;
+      __delivery* __next_ = nullptr;
+    };
+
+    struct __subscriber {
+      // Emits the values of the group one at a time. Called with the lock of
+      // the operation held, which it may release.
+      virtual void __drive(std::unique_lock<std::mutex>& __lock) noexcept = 0;
+
+     protected:
+      ~__subscriber() = default;
+    };
+
+    // The part of the state of the operation that the groups refer to, and
+    // that does not depend on the receiver.
+    struct __shared_state : __buffered::__error_state {
+      bool __done_ = false;
+    };
+
+    //
+    // The values of a group that arrive before its sequence is subscribed are
+    // buffered, and the next-senders of their items complete right away, so
+    // that a consumer that subscribes to the groups one after the other does
+    // not hold back the others. Once the group is subscribed, the next-sender
+    // of an item completes when the subscriber has consumed its value.
+    //
+    template <class _Key, class _Value>
+    struct __group {
+      __group(__shared_state* __state, const _Key& __key)
+        : __state_{__state}
+        , __key_{__key} {
+      }
+
+      void __deliver(__delivery<_Value>* __item) noexcept {
+        std::unique_lock __lock{__state_->__mutex_};
+        if (__closed_) {
+          // The subscriber does not want more values.
+          __lock.unlock();
+          __item->__complete_(__item, false);
+        } else if (__sub_ == nullptr) {
+          STDEXEC_TRY {
+            __buffer_.push_back(static_cast<_Value&&>(__item->__value_));
+          }
+          STDEXEC_CATCH_ALL {
+            __lock.unlock();
+            __state_->__store_error(std::current_exception());
+            __item->__complete_(__item, true);
+            return;
+          }
+          __lock.unlock();
+          __item->__complete_(__item, false);
+        } else {
+          __waiting_.push_back(__item);
+          __sub_->__drive(__lock);
+        }
+      }
+
+      __shared_state* __state_;
+      _Key __key_;
+      __subscriber* __sub_ = nullptr;
+      std::deque<_Value> __buffer_;
+      __intrusive_queue<&__delivery<_Value>::__next_> __waiting_;
+      bool __busy_ = false;
+      bool __driving_ = false;
+      bool __closed_ = false;
+      bool __completed_ = false;
+    };
+
+    template <class _Key, class _Value, class _Receiver>
+    struct __group_operation;
+
+    template <class _Key, class _Value, class _Receiver>
+    struct __group_next_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__next_done(false);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__next_done(true);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      __group_operation<_Key, _Value, _Receiver>* __op_;
+    };
+
+    template <class _Key, class _Value, class _Receiver>
+    struct __group_operation : __subscriber {
+      using __next_sender_t = next_sender_of_t<_Receiver, __call_result_t<just_t, _Value>>;
+      using __next_receiver_t = __group_next_receiver<_Key, _Value, _Receiver>;
+
+      __group_operation(__group<_Key, _Value>* __group, _Receiver&& __rcvr)
+        : __group_{__group}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      void start() & noexcept {
+        std::unique_lock __lock{__group_->__state_->__mutex_};
+        __group_->__sub_ = this;
+        __drive(__lock);
+      }
+
+      void __drive(std::unique_lock<std::mutex>& __lock) noexcept override {
+        auto& __grp = *__group_;
+        if (__grp.__driving_) {
+          // The loop that is running picks up the change.
+          return;
+        }
+        __grp.__driving_ = true;
+        while (!__grp.__busy_) {
+          if (!__grp.__buffer_.empty()) {
+            __value_.emplace(static_cast<_Value&&>(__grp.__buffer_.front()));
+            __grp.__buffer_.pop_front();
+          } else if (!__grp.__waiting_.empty()) {
+            __current_ = __grp.__waiting_.pop_front();
+            __value_.emplace(static_cast<_Value&&>(__current_->__value_));
+          } else {
+            if ((__grp.__closed_ || __grp.__state_->__done_) && !__grp.__completed_) {
+              __grp.__completed_ = true;
+              __grp.__driving_ = false;
+              bool __stopped = !__grp.__closed_ && __grp.__state_->__broken_;
+              __lock.unlock();
+              if (__stopped) {
+                STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+              } else {
+                STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+              }
+              return;
+            }
+            break;
+          }
+          __grp.__busy_ = true;
+          __lock.unlock();
+          __emit();
+          __lock.lock();
+        }
+        __grp.__driving_ = false;
+      }
+
+      void __emit() noexcept {
+        STDEXEC_TRY {
+          auto& __op = __next_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__rcvr_, just(static_cast<_Value&&>(*__value_))),
+            __next_receiver_t{this});
+          __value_.reset();
+          STDEXEC::start(__op);
+        }
+        STDEXEC_CATCH_ALL {
+          __value_.reset();
+          __group_->__state_->__store_error(std::current_exception());
+          __next_done(true);
+        }
+      }
+
+      // Called when the next-sender of the current value has completed. A
+      // stopped next-sender closes the group: the remaining values are
+      // dropped, and the sequence of the group completes.
+      void __next_done(bool __stopped) noexcept {
+        auto& __grp = *__group_;
+        __intrusive_queue<&__delivery<_Value>::__next_> __dropped;
+        if (__stopped) {
+          std::scoped_lock __lock{__grp.__state_->__mutex_};
+          __grp.__closed_ = true;
+          __grp.__buffer_.clear();
+          __dropped = static_cast<decltype(__dropped)&&>(__grp.__waiting_);
+        }
+        // The group stays busy until the items have been completed, so that
+        // the sequence of the group cannot complete in the meantime.
+        if (auto* __item = std::exchange(__current_, nullptr)) {
+          __item->__complete_(__item, false);
+        }
+        while (!__dropped.empty()) {
+          auto* __item = __dropped.pop_front();
+          __item->__complete_(__item, false);
+        }
+        std::unique_lock __lock{__grp.__state_->__mutex_};
+        __grp.__busy_ = false;
+        __drive(__lock);
+      }
+
+      __group<_Key, _Value>* __group_;
+      _Receiver __rcvr_;
+      __optional<_Value> __value_;
+      __delivery<_Value>* __current_ = nullptr;
+      __optional<connect_result_t<__next_sender_t, __next_receiver_t>> __next_op_;
+    };
+
+    //
+    // The sequence of the values of one group. It completes with set_value()
+    // once the input sequence has completed and all values of the group have
+    // been consumed, or with set_stopped() if the input sequence has failed.
+    //
+    template <class _Key, class _Value>
+    struct __group_sequence {
+      using sender_concept = sequence_sender_t;
+      using item_types = exec::item_types<__call_result_t<just_t, _Value>>;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+
+      template <sequence_receiver_of<item_types> _Receiver>
+      auto subscribe(_Receiver __rcvr) const noexcept
+        -> __group_operation<_Key, _Value, _Receiver> {
+        return {__group_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      [[nodiscard]]
+      auto key() const noexcept -> const _Key& {
+        return __group_->__key_;
+      }
+
+      __group<_Key, _Value>* __group_;
+    };
+
+    template <class _Key, class _Value>
+    using __group_sender_t = __call_result_t<just_t, __group_sequence<_Key, _Value>>;
+
+    template <class _OperationBase>
+    struct __emit_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__release();
+      }
+
+      void set_stopped() noexcept {
+        __op_->__break();
+        __op_->__release();
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _OperationBase* __op_;
+    };
+
+    //
+    // A group is created for every new key, and its sequence is emitted as an
+    // item of the output sequence right away. The groups are kept in a hash
+    // map until the operation is destroyed, so that the sequence of a group
+    // remains valid for as long as the output sequence runs.
+    //
+    // The output sequence completes once the input sequence has completed and
+    // the next-senders of all groups have completed.
+    //
+    template <class _Receiver, class _Key, class _Value, class _KeyFn>
+    struct __operation_base : __shared_state {
+      using __receiver_t = _Receiver;
+      using __value_t = _Value;
+      using __group_t = __group<_Key, _Value>;
+      using __next_sender_t = next_sender_of_t<_Receiver, __group_sender_t<_Key, _Value>>;
+      using __emit_op_t = connect_result_t<__next_sender_t, __emit_receiver<__operation_base>>;
+
+      struct __group_entry : __group_t {
+        using __group_t::__group_t;
+
+        __optional<__emit_op_t> __emit_op_;
+      };
+
+      __operation_base(_Receiver __rcvr, _KeyFn __key_fn)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __key_fn_{static_cast<_KeyFn&&>(__key_fn)} {
+      }
+
+      void __push(__delivery<_Value>* __item) noexcept {
+        __group_entry* __grp = nullptr;
+        bool __is_new = false;
+        STDEXEC_TRY {
+          _Key __key = std::invoke(__key_fn_, std::as_const(__item->__value_));
+          std::unique_lock __lock{__mutex_};
+          if (__broken_) {
+            __lock.unlock();
+            __item->__complete_(__item, true);
+            return;
+          }
+          auto __it = __groups_.find(__key);
+          if (__it == __groups_.end()) {
+            auto __entry = std::make_unique<__group_entry>(this, __key);
+            __it = __groups_.emplace(static_cast<_Key&&>(__key), std::move(__entry)).first;
+            __is_new = true;
+            ++__pending_;
+          }
+          __grp = __it->second.get();
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __item->__complete_(__item, true);
+          return;
+        }
+        if (__is_new) {
+          __emit(__grp);
+        }
+        __grp->__deliver(__item);
+      }
+
+      void __emit(__group_entry* __grp) noexcept {
+        STDEXEC_TRY {
+          auto& __op = __grp->__emit_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__rcvr_, just(__group_sequence<_Key, _Value>{__grp})),
+            __emit_receiver<__operation_base>{this});
+          STDEXEC::start(__op);
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __release();
+        }
+      }
+
+      // Called when the input sequence has completed. The groups that are
+      // subscribed and idle complete their sequences now, the others do so
+      // when their last value has been consumed.
+      void __input_complete() noexcept {
+        {
+          std::scoped_lock __lock{__mutex_};
+          __done_ = true;
+        }
+        for (auto& [__key, __grp]: __groups_) {
+          std::unique_lock __lock{__mutex_};
+          if (__grp->__sub_ != nullptr) {
+            __grp->__sub_->__drive(__lock);
+          }
+        }
+        __release();
+      }
+
+      // __pending_ counts the emitted groups whose next-sender has not yet
+      // completed, plus one for the input sequence.
+      void __release() noexcept {
+        bool __last = false;
+        {
+          std::scoped_lock __lock{__mutex_};
+          __last = --__pending_ == 0;
+        }
+        if (__last) {
+          __complete();
+        }
+      }
+
+      void __complete() noexcept {
+        __buffered::__complete_receiver(__rcvr_, __error_, __stopped_);
+      }
+
+      _Receiver __rcvr_;
+      _KeyFn __key_fn_;
+      std::unordered_map<_Key, std::unique_ptr<__group_entry>> __groups_;
+      std::size_t __pending_ = 1;
+    };
+
+    template <class _OperationBase, class _Receiver>
+    struct __push_operation : __delivery<typename _OperationBase::__value_t> {
+      using __value_t = _OperationBase::__value_t;
+
+      __push_operation(_OperationBase* __op, __value_t&& __value, _Receiver&& __rcvr)
+        : __delivery<__value_t>{static_cast<__value_t&&>(__value), &__complete}
+        , __op_{__op}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      void start() & noexcept {
+        __op_->__push(this);
+      }
+
+      static void __complete(__delivery<__value_t>* __item, bool __stopped) noexcept {
+        auto* __self = static_cast<__push_operation*>(__item);
+        if (__stopped) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__self->__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__self->__rcvr_));
+        }
+      }
+
+      _OperationBase* __op_;
+      _Receiver __rcvr_;
+    };
+
+    // Hands the value of an item over to the operation.
+    template <class _OperationBase>
+    struct __push_sender {
+      using sender_concept = sender_t;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+      using __value_t = _OperationBase::__value_t;
+
+      template <receiver_of<completion_signatures> _Receiver>
+      auto connect(_Receiver __rcvr) && noexcept(__nothrow_move_constructible<__value_t>)
+        -> __push_operation<_OperationBase, _Receiver> {
+        return {__op_, static_cast<__value_t&&>(__value_), static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      _OperationBase* __op_;
+      __value_t __value_;
+    };
+
+    template <class _OperationBase>
+    struct __push_fn {
+      template <class... _Values>
+      auto operator()(_Values&&... __values) const -> __push_sender<_OperationBase> {
+        using __value_t = _OperationBase::__value_t;
+        return {__op_, __value_t(static_cast<_Values&&>(__values)...)};
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _Sequence, class _Receiver, class _KeyFn>
+    using __operation_base_for_t = __operation_base<
+      _Receiver,
+      __key_of_t<_KeyFn, __value_of_t<_Sequence, env_of_t<_Receiver>>>,
+      __value_of_t<_Sequence, env_of_t<_Receiver>>,
+      _KeyFn
+    >;
+
+    template <class _Sequence, class _Receiver, class _KeyFn>
+    struct __operation : __operation_base_for_t<_Sequence, _Receiver, _KeyFn> {
+      using __base_t = __operation_base_for_t<_Sequence, _Receiver, _KeyFn>;
+      using __receiver_t = __buffered::__receiver<__base_t, __push_fn<__base_t>>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, _KeyFn __key_fn)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<_KeyFn&&>(__key_fn)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _KeyFn, class _Sequence>
+      auto operator()(__ignore, _KeyFn __key_fn, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _KeyFn> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<_KeyFn&&>(__key_fn)};
+      }
+    };
+
+    //
+    // group_by is a sequence adaptor that splits a sequence into groups by
+    // the key that key_fn returns for the value of each item. Its items are
+    // sequence senders, one for each key in the order of first appearance,
+    // whose items are the values of that key in the order of arrival. The
+    // sequence sender of a group has a key() member that returns its key.
+    //
+    // The output sequence is meant to be consumed with merge_each, which
+    // subscribes to every group as it is emitted. The values of a group that
+    // arrive before it is subscribed are buffered without limit. The group
+    // must be subscribed before the output sequence completes.
+    //
+    // A group completes once the input sequence has completed. A group whose
+    // next-sender completes with set_stopped() is closed, and the remaining
+    // values of its key are dropped. If the next-sender of a group sequence
+    // completes with set_stopped(), no more groups are created.
+    //
+    // The keys must be hashable and equality comparable. The first error of
+    // an item, of key_fn or of the input sequence is stored, stops the
+    // producer, and is delivered as set_error(std::exception_ptr). The groups
+    // then complete with set_stopped().
+    //
+    struct group_by_t {
+      template <sender _Sequence, class _KeyFn>
+      auto operator()(_Sequence&& __sndr, _KeyFn __key_fn) const
+        noexcept(__nothrow_decay_copyable<_Sequence> && __nothrow_move_constructible<_KeyFn>)
+          -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<group_by_t>(
+          static_cast<_KeyFn&&>(__key_fn), static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <class _KeyFn>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(_KeyFn __key_fn) const
+        noexcept(__nothrow_move_constructible<_KeyFn>) {
+        return __closure(*this, static_cast<_KeyFn&&>(__key_fn));
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, group_by_t>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, group_by_t>);
+        using __key_fn_t = __decay_t<__data_of<_Self>>;
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _ItemSender>() {
+              return __mtype<__minvoke<__buffered::__item_value_fn<_Env...>, _ItemSender>>();
+            },
+            []<class... _Values>(__mtype<_Values>...) {
+              using __values_t = __minvoke<__munique<__q<__mlist>>, _Values...>;
+              if constexpr (__mapply<__msize, __values_t>::value == 0) {
+                return item_types<>();
+              } else if constexpr (__mapply<__msize, __values_t>::value == 1) {
+                using __value_t = __mapply<__q<__msingle>, __values_t>;
+                return item_types<
+                  __group_sender_t<__key_of_t<__key_fn_t, __value_t>, __value_t>
+                >();
+              } else {
+                return exec::__invalid_item_types<
+                  _GROUP_BY_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_,
+                  _WITH_PRETTY_SEQUENCE_<__child_of<_Self>>,
+                  __fn_t<_WITH_ENVIRONMENT_, _Env>...
+                >();
+              }
+            });
+        }
+      }
+
+      template <sender_expr_for<group_by_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<group_by_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __group_by
+
+  using __group_by::group_by_t;
+  inline constexpr group_by_t group_by{};
+} // namespace exec
@@ -27,6 +27,7 @@
 #include "../../stdexec/__detail/__config.hpp"
 #include "../../stdexec/__detail/__diagnostics.hpp"
 #include "../../stdexec/__detail/__execution_fwd.hpp"
+#include "../../stdexec/__detail/__intrusive_queue.hpp"
 #include "../../stdexec/__detail/__meta.hpp"
 #include "../../stdexec/__detail/__sender_introspection.hpp"
 #include "../../stdexec/__detail/__stop_token.hpp"
@@ -35,6 +36,8 @@
 #include "../__detail/__basic_sequence.hpp"
 
 #include <atomic>
+#include <cstddef>
+#include <mutex>
 
 namespace exec {
   namespace __merge_each {
@@ -292,6 +295,17 @@ namespace exec {
       __nested_stop_t* __source_;
     };
 
+    struct __next_operation_interface {
+      virtual ~__next_operation_interface() = default;
+      virtual void nested_sequence_complete() noexcept = 0;
+      virtual void nested_sequence_break() noexcept = 0;
+      virtual void start_nested_sequence() noexcept = 0;
+
+      // links the operations that wait for a free slot when the number of
+      // concurrently running nested sequences is bounded
+      __next_operation_interface* __next_waiting_ = nullptr;
+    };
+
     template <class _Receiver, class _ErrorStorage>
     struct __operation_base : __operation_base_interface<_ErrorStorage> {
       using __nested_stop_t = __nested_stop<_Receiver>;
@@ -307,9 +321,10 @@ namespace exec {
       using __error_op_t =
         STDEXEC::connect_result_t<__error_next_sender_t, __error_next_receiver_t>;
 
-      explicit __operation_base(_Receiver __receiver) noexcept
+      explicit __operation_base(_Receiver __receiver, std::size_t __max_concurrency) noexcept
         : __interface_t{&__error_storage_}
-        , __rcvr_{static_cast<_Receiver&&>(__receiver)} {
+        , __rcvr_{static_cast<_Receiver&&>(__receiver)}
+        , __max_concurrency_{__max_concurrency} {
         __interface_t::__token_ = __nested_stop_.get_token();
       }
 
@@ -324,7 +339,9 @@ namespace exec {
         case __completion_t::__stopped:
           // We are the first child to complete with an error, so we must save the error. (Any
           // subsequent errors are ignored.)
-          if constexpr (__nothrow_decay_copyable<_Error>) {
+          if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+            __ex_ = static_cast<_Error&&>(__error);
+          } else if constexpr (__nothrow_decay_copyable<_Error>) {
             __ex_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
           } else {
             STDEXEC_TRY {
@@ -339,15 +356,12 @@ namespace exec {
         }
       }
       void set_break() noexcept {
-        switch (__completion_.exchange(__completion_t::__stopped)) {
-        case __completion_t::__started:
+        // A break must not replace an error that has already been stored.
+        auto __expected = __completion_t::__started;
+        if (__completion_.compare_exchange_strong(__expected, __completion_t::__stopped)) {
           // We must request stop. When the previous state is __error or __stopped, then stop has
           // already been requested.
           __nested_stop_.request_stop();
-          break;
-        case __completion_t::__stopped:
-          [[fallthrough]];             // We're already in the "stopped" state. Ignore the break.
-        case __completion_t::__error:; // We're already in the "error" state. Ignore the break.
         }
       }
 
@@ -371,6 +385,65 @@ namespace exec {
         set_break();
         complete_if_none_active();
       }
+
+      // Returns true if the nested sequence of __next_op may be subscribed
+      // now. Otherwise __next_op is queued and started by release_slot() once
+      // a running nested sequence completes. Since the next-sender of a queued
+      // nested sequence does not complete, the producer of the outer sequence
+      // is held back as well.
+      auto acquire_slot(__next_operation_interface* __next_op) noexcept -> bool {
+        if (__max_concurrency_ == 0) {
+          return true;
+        }
+        std::scoped_lock __lock{__slots_mutex_};
+        if (__running_ < __max_concurrency_) {
+          ++__running_;
+          return true;
+        }
+        __waiting_.push_back(__next_op);
+        return false;
+      }
+
+      // Hands the slot of a completed nested sequence to the oldest waiting
+      // one, if any.
+      //
+      // A waiting nested sequence that completes inline releases its slot
+      // again from inside start_nested_sequence(). Rather than recursing, such
+      // a release is counted and handed on by the loop that is already
+      // draining, so the stack does not grow with the number of queued
+      // sequences. The caller still counts as active until this returns,
+      // which keeps the operation alive while the loop runs.
+      void release_slot() noexcept {
+        if (__max_concurrency_ == 0) {
+          return;
+        }
+        {
+          std::scoped_lock __lock{__slots_mutex_};
+          ++__released_;
+          if (__draining_) {
+            return;
+          }
+          __draining_ = true;
+        }
+        while (true) {
+          __next_operation_interface* __next_op = nullptr;
+          {
+            std::scoped_lock __lock{__slots_mutex_};
+            if (__released_ == 0) {
+              __draining_ = false;
+              return;
+            }
+            --__released_;
+            if (__waiting_.empty()) {
+              --__running_;
+              continue;
+            }
+            __next_op = __waiting_.pop_front();
+          }
+          __next_op->start_nested_sequence();
+        }
+      }
+
       void nested_value_started() noexcept override {
         ++__active_;
       }
@@ -462,6 +535,14 @@ namespace exec {
       std::atomic<__completion_t> __completion_{__completion_t::__started};
       __nested_stop_t __nested_stop_{};
       STDEXEC::__optional<__error_op_t> __error_op_{};
+      // 0 means that the number of running nested sequences is not bounded
+      std::size_t __max_concurrency_;
+      std::size_t __running_ = 0;
+      // slots released while a call to release_slot() is handing them on
+      std::size_t __released_ = 0;
+      bool __draining_ = false;
+      std::mutex __slots_mutex_;
+      __intrusive_queue<&__next_operation_interface::__next_waiting_> __waiting_;
     };
 
     //
@@ -627,12 +708,6 @@ namespace exec {
     //     send no more sequences.
     //
 
-    struct __next_operation_interface {
-      virtual ~__next_operation_interface() = default;
-      virtual void nested_sequence_complete() noexcept = 0;
-      virtual void nested_sequence_break() noexcept = 0;
-    };
-
     template <class _NextReceiver, class _OperationBase, class _NestedSeqOp>
     struct __next_operation_base : __next_operation_interface {
       explicit __next_operation_base(_NextReceiver __receiver, _OperationBase* __op)
@@ -644,12 +719,14 @@ namespace exec {
 
       void nested_sequence_complete() noexcept override {
         auto __op = __op_;
+        __op->release_slot();
         STDEXEC::set_value(static_cast<_NextReceiver&&>(this->__rcvr_));
         __op->nested_sequence_complete();
       }
 
       void nested_sequence_break() noexcept override {
         auto __op = __op_;
+        __op->release_slot();
         STDEXEC::set_stopped(static_cast<_NextReceiver&&>(this->__rcvr_));
         __op->nested_sequence_break();
       }
@@ -958,7 +1035,7 @@ namespace exec {
         STDEXEC_CATCH_ALL {
           if constexpr (!__is_nothrow) {
             __op_->store_error(std::current_exception());
-            __op_->nested_sequence_break();
+            __next_seq_op_->nested_sequence_break();
           }
         }
       }
@@ -966,11 +1043,11 @@ namespace exec {
       template <class _Error>
       void set_error(_Error&& __error) noexcept {
         __op_->store_error(static_cast<_Error&&>(__error));
-        __op_->nested_sequence_break();
+        __next_seq_op_->nested_sequence_break();
       }
 
       void set_stopped() noexcept {
-        __op_->nested_sequence_complete();
+        __next_seq_op_->nested_sequence_complete();
       }
 
       using __env_t = typename _OperationBase::__nested_stop_env_t;
@@ -1006,6 +1083,12 @@ namespace exec {
 
       void start() & noexcept {
         __op_->nested_sequence_started();
+        if (__op_->acquire_slot(this)) {
+          STDEXEC::start(__nested_sequence_op_);
+        }
+      }
+
+      void start_nested_sequence() noexcept override {
         STDEXEC::start(__nested_sequence_op_);
       }
 
@@ -1099,9 +1182,9 @@ namespace exec {
       using __receiver = __receive_nested_sequences<__base_t, __nested_seq_op_t>;
       using __op_t = subscribe_result_t<_Sequence, __receiver>;
 
-      explicit __operation(_Receiver __rcvr, _Sequence __sequence)
+      explicit __operation(_Receiver __rcvr, _Sequence __sequence, std::size_t __max_concurrency)
         noexcept(__nothrow_subscribable<_Sequence, __receiver>)
-        : __base_t{static_cast<_Receiver&&>(__rcvr)}
+        : __base_t{static_cast<_Receiver&&>(__rcvr), __max_concurrency}
         , __op_{subscribe(static_cast<_Sequence&&>(__sequence), __receiver{this})} {
       }
 
@@ -1138,12 +1221,18 @@ namespace exec {
       using __opstate_t = __operation_t<_Receiver, _Sequence>;
 
       template <class _Sequence>
-      auto operator()(__ignore, __ignore, _Sequence __sequence) noexcept(
-        __nothrow_constructible_from<__operation_t<_Receiver, _Sequence>, _Receiver, _Sequence>)
-        -> __opstate_t<_Sequence> {
+      auto operator()(__ignore, std::size_t __max_concurrency, _Sequence __sequence) noexcept(
+        __nothrow_constructible_from<
+          __operation_t<_Receiver, _Sequence>,
+          _Receiver,
+          _Sequence,
+          std::size_t
+        >) -> __opstate_t<_Sequence> {
         if constexpr (__ok<__opstate_t<_Sequence>>) {
           return __opstate_t<_Sequence>{
-            static_cast<_Receiver&&>(__rcvr_), static_cast<_Sequence&&>(__sequence)};
+            static_cast<_Receiver&&>(__rcvr_),
+            static_cast<_Sequence&&>(__sequence),
+            __max_concurrency};
         } else {
           return {};
         }
@@ -1168,12 +1257,19 @@ namespace exec {
     // This allows individual nested sequences to be stopped without
     // breaking the merge of the remaining sequences.
     //
+    // merge_each(sequence, max_concurrency) subscribes to at most
+    // max_concurrency nested sequences at a time. Further nested sequences
+    // are subscribed only when a running one completes, and until then their
+    // next-senders do not complete, which applies backpressure to the
+    // producer of the outer sequence. A max_concurrency of 0 is unbounded.
+    //
 
     struct merge_each_t {
       template <class _Sequence>
-      auto operator()(_Sequence&& __sequence) const noexcept(__nothrow_decay_copyable<_Sequence>)
-        -> __well_formed_sequence_sender auto {
-        return make_sequence_expr<merge_each_t>(__(), static_cast<_Sequence&&>(__sequence));
+      auto operator()(_Sequence&& __sequence, std::size_t __max_concurrency = 0) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<merge_each_t>(
+          __max_concurrency, static_cast<_Sequence&&>(__sequence));
       }
 
       template <sender_expr_for<merge_each_t> _Self, class... _Env>
@@ -0,0 +1,685 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__intrusive_queue.hpp"
+#include "../../stdexec/__detail/__optional.hpp"
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+namespace exec {
+  // Whether par_transform_each emits its results in the order of the input
+  // items, or as soon as they are available.
+  enum class item_order {
+    unordered,
+    preserved
+  };
+
+  namespace __par_transform_each {
+    using namespace STDEXEC;
+
+    template <class _Scheduler, class _Fn>
+    struct __params {
+      _Scheduler __sched_;
+      std::size_t __max_inflight_;
+      _Fn __fn_;
+      item_order __order_;
+    };
+
+    // The decayed values of an item, which must complete with a single set of
+    // values.
+    template <class _Item, class... _Env>
+    using __item_values_t = __value_types_t<
+      __completion_signatures_of_t<_Item, _Env...>,
+      __qq<__decayed_std_tuple>,
+      __q<__msingle>
+    >;
+
+    template <class _Fn, class _Values>
+    struct __fn_result;
+
+    template <class _Fn, class... _Values>
+    struct __fn_result<_Fn, std::tuple<_Values...>> {
+      using __t = __call_result_t<_Fn&, _Values...>;
+    };
+
+    template <class _Result>
+    struct __just_result {
+      using __t = __call_result_t<just_t, __decay_t<_Result>>;
+    };
+
+    template <>
+    struct __just_result<void> {
+      using __t = __call_result_t<just_t>;
+    };
+
+    // The item that is emitted for the result of applying _Fn to an item.
+    template <class _Fn, class _Item, class... _Env>
+    using __result_sender_t =
+      __t<__just_result<__t<__fn_result<_Fn, __item_values_t<_Item, _Env...>>>>>;
+
+    // Applies fn to the stored values of an item on the scheduler's thread.
+    template <class _Fn, class _Values>
+    struct __invoke_fn {
+      auto operator()() const -> __t<__fn_result<_Fn, _Values>> {
+        return std::apply(*__fn_, static_cast<_Values&&>(*__values_));
+      }
+
+      _Fn* __fn_;
+      _Values* __values_;
+    };
+
+    // An item that has been admitted. Its result is emitted once the work
+    // completes, and, if the order is preserved, once all items before it have
+    // been emitted.
+    struct __work_base {
+      explicit __work_base(std::size_t __seq) noexcept
+        : __seq_{__seq} {
+      }
+
+      virtual ~__work_base() = default;
+      virtual void __emit() noexcept = 0;
+
+      std::size_t __seq_;
+      bool __has_result_ = false;
+    };
+
+    // An item that waits for one of the max_inflight slots. Once admitted,
+    // __resume_ completes the next-sender of the item, which lets the producer
+    // continue.
+    struct __slot_waiter {
+      void (*__admit_)(__slot_waiter*, bool __admitted) noexcept;
+      void (*__resume_)(__slot_waiter*, bool __stop) noexcept;
+      std::size_t __seq_ = 0;
+      __slot_waiter* __next_ = nullptr;
+    };
+
+    template <class _Receiver, class _Scheduler, class _Fn>
+    struct __operation_base {
+      using __receiver_t = _Receiver;
+      using __scheduler_t = _Scheduler;
+      using __fn_t = _Fn;
+
+      __operation_base(_Receiver __rcvr, __params<_Scheduler, _Fn> __prms)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __params_{static_cast<__params<_Scheduler, _Fn>&&>(__prms)} {
+        if (__params_.__order_ == item_order::preserved) {
+          __reorder_ = std::make_unique<__slot[]>(__params_.__max_inflight_);
+        }
+      }
+
+      // Admits __waiter right away if a slot is free, and otherwise queues it
+      // until release_slot() passes a slot on. Until it is admitted, the
+      // next-sender of the item does not complete, which holds back the
+      // producer.
+      void __acquire_slot(__slot_waiter* __waiter) noexcept {
+        bool __admitted = true;
+        {
+          std::scoped_lock __lock{__mutex_};
+          if (__broken_) {
+            __admitted = false;
+          } else if (__inflight_ < __params_.__max_inflight_) {
+            ++__inflight_;
+            __waiter->__seq_ = __next_seq_++;
+          } else {
+            __waiting_.push_back(__waiter);
+            return;
+          }
+        }
+        __waiter->__admit_(__waiter, __admitted);
+      }
+
+      void __release_slot() noexcept {
+        __intrusive_queue<&__slot_waiter::__next_> __rejected;
+        __slot_waiter* __next = nullptr;
+        bool __complete = false;
+        {
+          std::scoped_lock __lock{__mutex_};
+          if (__broken_) {
+            __rejected = std::exchange(__waiting_, {});
+          } else if (!__waiting_.empty()) {
+            __next = __waiting_.pop_front();
+            __next->__seq_ = __next_seq_++;
+          }
+          if (__next == nullptr) {
+            --__inflight_;
+            __complete = __done_ && __inflight_ == 0;
+          }
+        }
+        while (!__rejected.empty()) {
+          auto* __waiter = __rejected.pop_front();
+          __waiter->__admit_(__waiter, false);
+        }
+        if (__next != nullptr) {
+          __next->__admit_(__next, true);
+        } else if (__complete) {
+          __complete_all();
+        }
+      }
+
+      // Called when the work of an admitted item has completed, or could not
+      // be started, in which case __work is null.
+      void __on_result(std::size_t __seq, __work_base* __work) noexcept {
+        if (__params_.__order_ == item_order::preserved) {
+          std::scoped_lock __lock{__mutex_};
+          __reorder_[__seq % __params_.__max_inflight_] = {__work, true};
+          if (__seq != __next_emit_ || __emitting_) {
+            return;
+          }
+          __emitting_ = true;
+        }
+        __emit_or_skip(__seq, __work);
+      }
+
+      void __emit_or_skip(std::size_t __seq, __work_base* __work) noexcept {
+        if (__work != nullptr && __work->__has_result_ && !__is_broken()) {
+          __work->__emit();
+        } else {
+          __on_emitted(__seq, __work);
+        }
+      }
+
+      // Called when the result of an item has been consumed downstream, or
+      // when there was nothing to emit. In preserved order, this passes the
+      // turn on to the next item if its result has already arrived.
+      void __on_emitted(std::size_t __seq, __work_base* __work) noexcept {
+        delete __work;
+        if (__params_.__order_ == item_order::unordered) {
+          __release_slot();
+          return;
+        }
+        __slot __next{};
+        std::size_t __next_seq = 0;
+        {
+          std::scoped_lock __lock{__mutex_};
+          __reorder_[__seq % __params_.__max_inflight_] = {};
+          __next_seq = ++__next_emit_;
+          __next = __reorder_[__next_seq % __params_.__max_inflight_];
+          __emitting_ = __next.__arrived_;
+        }
+        __release_slot();
+        if (__next.__arrived_) {
+          __emit_or_skip(__next_seq, __next.__work_);
+        }
+      }
+
+      void __sequence_complete() noexcept {
+        bool __complete = false;
+        {
+          std::scoped_lock __lock{__mutex_};
+          __done_ = true;
+          __complete = __inflight_ == 0;
+        }
+        if (__complete) {
+          __complete_all();
+        }
+      }
+
+      template <class _Error>
+      void __store_error(_Error&& __error) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __broken_ = true;
+        if (!__error_) {
+          if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+            __error_ = static_cast<_Error&&>(__error);
+          } else {
+            __error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+          }
+        }
+      }
+
+      void __break() noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __broken_ = true;
+        __stopped_ = true;
+      }
+
+      auto __is_broken() noexcept -> bool {
+        std::scoped_lock __lock{__mutex_};
+        return __broken_;
+      }
+
+      void __complete_all() noexcept {
+        if (__error_) {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(__rcvr_), static_cast<std::exception_ptr&&>(__error_));
+        } else if (__stopped_) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+        }
+      }
+
+      _Receiver __rcvr_;
+      __params<_Scheduler, _Fn> __params_;
+      std::mutex __mutex_;
+      std::size_t __inflight_ = 0;
+      std::size_t __next_seq_ = 0;
+      __intrusive_queue<&__slot_waiter::__next_> __waiting_;
+      // Only used when the order is preserved: __reorder_ holds the completed
+      // items that wait for their turn, indexed by sequence number modulo
+      // max_inflight, which is unique among the admitted items.
+      struct __slot {
+        __work_base* __work_ = nullptr;
+        bool __arrived_ = false;
+      };
+      std::unique_ptr<__slot[]> __reorder_;
+      std::size_t __next_emit_ = 0;
+      bool __emitting_ = false;
+      bool __done_ = false;
+      bool __broken_ = false;
+      bool __stopped_ = false;
+      std::exception_ptr __error_;
+    };
+
+    template <class _Work, class _Receiver>
+    struct __item_receiver {
+      using receiver_concept = receiver_t;
+
+      template <class... _Values>
+      void set_value(_Values&&... __values) noexcept {
+        STDEXEC_TRY {
+          __work_->__values_.emplace(static_cast<_Values&&>(__values)...);
+        }
+        STDEXEC_CATCH_ALL {
+          __work_->__op_->__store_error(std::current_exception());
+          __work_->__item_failed(true);
+          return;
+        }
+        __work_->__start_fn();
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __work_->__op_->__store_error(static_cast<_Error&&>(__error));
+        __work_->__item_failed(true);
+      }
+
+      void set_stopped() noexcept {
+        __work_->__item_failed(false);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__work_->__op_->__rcvr_);
+      }
+
+      _Work* __work_;
+    };
+
+    template <class _Work, class _Receiver>
+    struct __work_receiver {
+      using receiver_concept = receiver_t;
+
+      template <class... _Values>
+      void set_value(_Values&&... __values) noexcept {
+        STDEXEC_TRY {
+          __work_->__result_.emplace(STDEXEC::just(static_cast<_Values&&>(__values)...));
+          __work_->__has_result_ = true;
+        }
+        STDEXEC_CATCH_ALL {
+          __work_->__op_->__store_error(std::current_exception());
+        }
+        __work_->__op_->__on_result(__work_->__seq_, __work_);
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __work_->__op_->__store_error(static_cast<_Error&&>(__error));
+        __work_->__op_->__on_result(__work_->__seq_, __work_);
+      }
+
+      void set_stopped() noexcept {
+        __work_->__op_->__on_result(__work_->__seq_, __work_);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__work_->__op_->__rcvr_);
+      }
+
+      _Work* __work_;
+    };
+
+    template <class _Work, class _Receiver>
+    struct __emit_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __work_->__op_->__on_emitted(__work_->__seq_, __work_);
+      }
+
+      void set_stopped() noexcept {
+        __work_->__op_->__break();
+        __work_->__op_->__on_emitted(__work_->__seq_, __work_);
+      }
+
+      auto get_env() const noexcept -> env_of_t<_Receiver> {
+        return STDEXEC::get_env(__work_->__op_->__rcvr_);
+      }
+
+      _Work* __work_;
+    };
+
+    // An admitted item. The item itself runs inline, because it may refer to
+    // state of the producer that is only valid until its next-sender
+    // completes. Once it has produced its values, the producer resumes and fn
+    // is applied to the values on the scheduler. The result is then emitted
+    // downstream.
+    template <class _Item, class _OperationBase>
+    struct __work : __work_base {
+      using __receiver_t = _OperationBase::__receiver_t;
+      using __fn_t = _OperationBase::__fn_t;
+      using __values_t = __item_values_t<_Item, env_of_t<__receiver_t>>;
+      using __fn_sender_t = __call_result_t<
+        then_t,
+        schedule_result_t<typename _OperationBase::__scheduler_t&>,
+        __invoke_fn<__fn_t, __values_t>
+      >;
+      using __result_t = __result_sender_t<__fn_t, _Item, env_of_t<__receiver_t>>;
+      using __emit_sender_t = next_sender_of_t<__receiver_t, __result_t>;
+      using __item_receiver_t = __item_receiver<__work, __receiver_t>;
+      using __work_receiver_t = __work_receiver<__work, __receiver_t>;
+      using __emit_receiver_t = __emit_receiver<__work, __receiver_t>;
+
+      __work(_OperationBase* __op, __slot_waiter* __waiter, _Item&& __item)
+        : __work_base{__waiter->__seq_}
+        , __op_{__op}
+        , __waiter_{__waiter}
+        , __item_op_{STDEXEC::connect(static_cast<_Item&&>(__item), __item_receiver_t{this})} {
+      }
+
+      void __start_fn() noexcept {
+        __waiter_->__resume_(__waiter_, false);
+        STDEXEC_TRY {
+          STDEXEC::start(__fn_op_.__emplace_from(
+            STDEXEC::connect,
+            STDEXEC::then(
+              STDEXEC::schedule(__op_->__params_.__sched_),
+              __invoke_fn<__fn_t, __values_t>{&__op_->__params_.__fn_, &*__values_}),
+            __work_receiver_t{this}));
+        }
+        STDEXEC_CATCH_ALL {
+          __op_->__store_error(std::current_exception());
+          __op_->__on_result(__seq_, this);
+        }
+      }
+
+      // The item completed with an error or stopped. An error also stops the
+      // producer.
+      void __item_failed(bool __stop) noexcept {
+        __waiter_->__resume_(__waiter_, __stop);
+        __op_->__on_result(__seq_, this);
+      }
+
+      void __emit() noexcept final {
+        STDEXEC_TRY {
+          STDEXEC::start(__emit_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__op_->__rcvr_, static_cast<__result_t&&>(*__result_)),
+            __emit_receiver_t{this}));
+        }
+        STDEXEC_CATCH_ALL {
+          __op_->__store_error(std::current_exception());
+          __op_->__on_emitted(__seq_, this);
+        }
+      }
+
+      _OperationBase* __op_;
+      __slot_waiter* __waiter_;
+      __optional<__values_t> __values_;
+      __optional<__result_t> __result_;
+      connect_result_t<_Item, __item_receiver_t> __item_op_;
+      __optional<connect_result_t<__fn_sender_t, __work_receiver_t>> __fn_op_;
+      __optional<connect_result_t<__emit_sender_t, __emit_receiver_t>> __emit_op_;
+    };
+
+    template <class _Item, class _OperationBase, class _NextReceiver>
+    struct __next_operation : __slot_waiter {
+      __next_operation(_OperationBase* __op, _Item&& __item, _NextReceiver&& __rcvr)
+        : __slot_waiter{&__admit, &__resume}
+        , __op_{__op}
+        , __item_{static_cast<_Item&&>(__item)}
+        , __rcvr_{static_cast<_NextReceiver&&>(__rcvr)} {
+      }
+
+      void start() & noexcept {
+        __op_->__acquire_slot(this);
+      }
+
+      // Starts the item, or refuses it if the operation is stopping.
+      static void __admit(__slot_waiter* __waiter, bool __admitted) noexcept {
+        auto* __self = static_cast<__next_operation*>(__waiter);
+        if (!__admitted) {
+          STDEXEC::set_stopped(static_cast<_NextReceiver&&>(__self->__rcvr_));
+          return;
+        }
+        auto* __op = __self->__op_;
+        __work<_Item, _OperationBase>* __w = nullptr;
+        STDEXEC_TRY {
+          __w = new __work<_Item, _OperationBase>(
+            __op, __self, static_cast<_Item&&>(__self->__item_));
+        }
+        STDEXEC_CATCH_ALL {
+          __op->__store_error(std::current_exception());
+          std::size_t __seq = __self->__seq_;
+          STDEXEC::set_stopped(static_cast<_NextReceiver&&>(__self->__rcvr_));
+          __op->__on_result(__seq, nullptr);
+          return;
+        }
+        STDEXEC::start(__w->__item_op_);
+      }
+
+      static void __resume(__slot_waiter* __waiter, bool __stop) noexcept {
+        auto* __self = static_cast<__next_operation*>(__waiter);
+        if (__stop) {
+          STDEXEC::set_stopped(static_cast<_NextReceiver&&>(__self->__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_NextReceiver&&>(__self->__rcvr_));
+        }
+      }
+
+      _OperationBase* __op_;
+      _Item __item_;
+      _NextReceiver __rcvr_;
+    };
+
+    template <class _Item, class _OperationBase>
+    struct __next_sender {
+      using sender_concept = sender_t;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+
+      template <receiver_of<completion_signatures> _NextReceiver>
+      auto connect(_NextReceiver __rcvr) &&
+        -> __next_operation<_Item, _OperationBase, _NextReceiver> {
+        return {__op_, static_cast<_Item&&>(__item_), static_cast<_NextReceiver&&>(__rcvr)};
+      }
+
+      _OperationBase* __op_;
+      _Item __item_;
+    };
+
+    template <class _OperationBase>
+    struct __receiver {
+      using receiver_concept = receiver_t;
+
+      template <sender _Item>
+      auto set_next(_Item&& __item) & noexcept(__nothrow_decay_copyable<_Item>)
+        -> __next_sender<__decay_t<_Item>, _OperationBase> {
+        return {__op_, static_cast<_Item&&>(__item)};
+      }
+
+      void set_value() noexcept {
+        __op_->__sequence_complete();
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __op_->__store_error(static_cast<_Error&&>(__error));
+        __op_->__sequence_complete();
+      }
+
+      void set_stopped() noexcept {
+        __op_->__break();
+        __op_->__sequence_complete();
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _Sequence, class _Receiver, class _Scheduler, class _Fn>
+    struct __operation : __operation_base<_Receiver, _Scheduler, _Fn> {
+      using __base_t = __operation_base<_Receiver, _Scheduler, _Fn>;
+      using __receiver_t = __receiver<__base_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, __params<_Scheduler, _Fn> __prms)
+        : __base_t{
+            static_cast<_Receiver&&>(__rcvr),
+            static_cast<__params<_Scheduler, _Fn>&&>(__prms)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Scheduler, class _Fn, class _Sequence>
+      auto operator()(__ignore, __params<_Scheduler, _Fn> __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Scheduler, _Fn> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<__params<_Scheduler, _Fn>&&>(__prms)};
+      }
+    };
+
+    //
+    // par_transform_each is a sequence adaptor that applies fn to the values
+    // of each item on sched. Up to max_inflight items are in progress at a
+    // time. The next-sender of an item completes as soon as the item has
+    // produced its values, unless all slots are taken, in which case it waits
+    // until an earlier result has been emitted. Results are emitted as items
+    // that send the decayed value returned by fn.
+    //
+    // With item_order::unordered, a result is emitted as soon as it is
+    // available. With item_order::preserved, results are emitted one at a
+    // time, in the order of the input items.
+    //
+    // Items that complete with set_stopped() are dropped. The first error
+    // stops the producer and is delivered as set_error(std::exception_ptr)
+    // once all items in progress have completed.
+    //
+    struct par_transform_each_t {
+      template <sender _Sequence, scheduler _Scheduler, class _Fn>
+      auto operator()(
+        _Sequence&& __sndr,
+        _Scheduler __sched,
+        std::size_t __max_inflight,
+        _Fn __fn,
+        item_order __order = item_order::unordered) const
+        -> __well_formed_sequence_sender auto {
+        STDEXEC_ASSERT(__max_inflight != 0);
+        return make_sequence_expr<par_transform_each_t>(
+          __params<_Scheduler, _Fn>{
+            static_cast<_Scheduler&&>(__sched), __max_inflight, static_cast<_Fn&&>(__fn), __order},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <scheduler _Scheduler, class _Fn>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(
+        _Scheduler __sched,
+        std::size_t __max_inflight,
+        _Fn __fn,
+        item_order __order = item_order::unordered) const {
+        return __closure(
+          *this,
+          static_cast<_Scheduler&&>(__sched),
+          __max_inflight,
+          static_cast<_Fn&&>(__fn),
+          __order);
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, par_transform_each_t>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, par_transform_each_t>);
+        using __params_t = __decay_t<__data_of<_Self>>;
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _Item>() {
+              return __mtype<__result_sender_t<decltype(__params_t::__fn_), _Item, _Env...>>();
+            },
+            []<class... _Results>(__mtype<_Results>...) {
+              return __minvoke<__munique<__qq<item_types>>, _Results...>();
+            });
+        }
+      }
+
+      template <sender_expr_for<par_transform_each_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<par_transform_each_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __par_transform_each
+
+  using __par_transform_each::par_transform_each_t;
+  inline constexpr par_transform_each_t par_transform_each{};
+} // namespace exec
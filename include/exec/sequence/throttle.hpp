@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+#include "../timed_scheduler.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "stdexec/__detail/__intrusive_queue.hpp"
+#include "stdexec/__detail/__optional.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace exec {
+  namespace __throttle {
+    using namespace STDEXEC;
+
+    template <class _Scheduler>
+    struct __params {
+      _Scheduler __sched_;
+      duration_of_t<_Scheduler> __interval_;
+      std::size_t __burst_;
+    };
+
+    // An item that waits for a token before it is passed on.
+    struct __waiter {
+      void (*__resume_)(__waiter*, bool __stopped) noexcept = nullptr;
+      __waiter* __next_ = nullptr;
+    };
+
+    template <class _OperationBase, class _Receiver>
+    struct __token_operation : __waiter {
+      __token_operation(_OperationBase* __op, _Receiver __rcvr)
+        : __waiter{&__resume}
+        , __op_{__op}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      __token_operation(__token_operation&&) = delete;
+
+      void start() & noexcept {
+        __op_->__acquire(this);
+      }
+
+      static void __resume(__waiter* __self, bool __stopped) noexcept {
+        auto* __op = static_cast<__token_operation*>(__self);
+        if (__stopped) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__op->__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__op->__rcvr_));
+        }
+      }
+
+      _OperationBase* __op_;
+      _Receiver __rcvr_;
+    };
+
+    template <class _OperationBase>
+    struct __token_sender {
+      using sender_concept = sender_t;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+
+      template <receiver _Receiver>
+      auto connect(_Receiver __rcvr) const noexcept(__nothrow_move_constructible<_Receiver>)
+        -> __token_operation<_OperationBase, _Receiver> {
+        return {__op_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _Receiver, class _OperationBase>
+    struct __timer_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__on_timer(false);
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __op_->__store_error(static_cast<_Error&&>(__error));
+        __op_->__on_timer(true);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__on_timer(true);
+      }
+
+      auto get_env() const noexcept
+        -> prop<get_stop_token_t, stop_token_of_t<env_of_t<_Receiver>>> {
+        return prop{get_stop_token, STDEXEC::get_stop_token(STDEXEC::get_env(__op_->__rcvr_))};
+      }
+
+      _OperationBase* __op_;
+    };
+
+    //
+    // The tokens are refilled lazily from the time that has passed, one every
+    // __interval_, up to __burst_. An item that finds a token is passed on
+    // right away. The others wait in a queue, and a single timer, which is
+    // armed while the queue is not empty, wakes up when the next token is due
+    // and passes on as many of them as there are tokens.
+    //
+    template <class _Receiver, class _Scheduler>
+    struct __operation_base {
+      using __receiver_t = _Receiver;
+      using __time_point_t = time_point_of_t<_Scheduler>;
+      using __duration_t = duration_of_t<_Scheduler>;
+      using __timer_sender_t = __call_result_t<schedule_after_t, _Scheduler&, const __duration_t&>;
+      using __timer_op_t =
+        connect_result_t<__timer_sender_t, __timer_receiver<_Receiver, __operation_base>>;
+
+      __operation_base(_Receiver __rcvr, __params<_Scheduler> __prms)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __params_{static_cast<__params<_Scheduler>&&>(__prms)}
+        , __tokens_{__params_.__burst_} {
+      }
+
+      void __refill(__time_point_t __now) noexcept {
+        if (__tokens_ < __params_.__burst_ && __now >= __next_token_) {
+          auto __due = (__now - __next_token_) / __params_.__interval_ + 1;
+          if (static_cast<std::size_t>(__due) >= __params_.__burst_ - __tokens_) {
+            __tokens_ = __params_.__burst_;
+          } else {
+            __tokens_ += static_cast<std::size_t>(__due);
+            __next_token_ += __params_.__interval_ * __due;
+          }
+        }
+      }
+
+      auto __try_take(__time_point_t __now) noexcept -> bool {
+        __refill(__now);
+        if (__tokens_ == 0) {
+          return false;
+        }
+        if (__tokens_-- == __params_.__burst_) {
+          __next_token_ = __now + __params_.__interval_;
+        }
+        return true;
+      }
+
+      void __acquire(__waiter* __wtr) noexcept {
+        enum class __action_t {
+          __wait,
+          __resume,
+          __cancel,
+          __arm
+        };
+        __action_t __action = __action_t::__wait;
+        __duration_t __wait{};
+        {
+          std::scoped_lock __lock{__mutex_};
+          if (__cancelled_) {
+            __action = __action_t::__cancel;
+          } else {
+            auto __now = exec::now(__params_.__sched_);
+            if (__waiting_.empty() && __try_take(__now)) {
+              __action = __action_t::__resume;
+            } else {
+              __waiting_.push_back(__wtr);
+              if (!std::exchange(__timer_active_, true)) {
+                __wait = __next_token_ - __now;
+                __action = __action_t::__arm;
+              }
+            }
+          }
+        }
+        switch (__action) {
+        case __action_t::__resume:
+          __wtr->__resume_(__wtr, false);
+          break;
+        case __action_t::__cancel:
+          __wtr->__resume_(__wtr, true);
+          break;
+        case __action_t::__arm:
+          __arm_timer(__wait);
+          break;
+        case __action_t::__wait:;
+        }
+      }
+
+      // The items are resumed while the timer is still marked active, so that
+      // the input sequence, which may complete as a result, leaves the final
+      // completion to this function.
+      void __on_timer(bool __stopped) noexcept {
+        __intrusive_queue<&__waiter::__next_> __ready;
+        {
+          std::scoped_lock __lock{__mutex_};
+          if (__stopped) {
+            __cancelled_ = true;
+            __ready = std::exchange(__waiting_, {});
+          } else {
+            auto __now = exec::now(__params_.__sched_);
+            while (!__waiting_.empty() && __try_take(__now)) {
+              __ready.push_back(__waiting_.pop_front());
+            }
+          }
+        }
+        while (!__ready.empty()) {
+          auto* __wtr = __ready.pop_front();
+          __wtr->__resume_(__wtr, __stopped);
+        }
+
+        bool __arm = false;
+        bool __complete = false;
+        __duration_t __wait{};
+        {
+          std::scoped_lock __lock{__mutex_};
+          if (!__cancelled_ && !__waiting_.empty()) {
+            __wait = __next_token_ - exec::now(__params_.__sched_);
+            __arm = true;
+          } else {
+            __timer_active_ = false;
+            __complete = __done_;
+          }
+        }
+        if (__arm) {
+          __arm_timer(__wait);
+        } else if (__complete) {
+          __complete_with_result();
+        }
+      }
+
+      void __arm_timer(__duration_t __wait) noexcept {
+        STDEXEC_TRY {
+          __timer_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::schedule_after(__params_.__sched_, __wait),
+            __timer_receiver<_Receiver, __operation_base>{this});
+          STDEXEC::start(*__timer_op_);
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __on_timer(true);
+        }
+      }
+
+      // Called when the input sequence has completed. The completion is left
+      // to the timer if it is active.
+      void __input_complete() noexcept {
+        {
+          std::scoped_lock __lock{__mutex_};
+          __done_ = true;
+          if (__timer_active_) {
+            return;
+          }
+        }
+        __complete_with_result();
+      }
+
+      template <class _Error>
+      void __store_error(_Error&& __error) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        if (!__error_) {
+          if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+            __error_ = static_cast<_Error&&>(__error);
+          } else {
+            __error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+          }
+        }
+      }
+
+      void __break() noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __stopped_ = true;
+      }
+
+      void __complete_with_result() noexcept {
+        if (__error_) {
+          STDEXEC::set_error(
+            static_cast<_Receiver&&>(__rcvr_), static_cast<std::exception_ptr&&>(__error_));
+        } else if (__stopped_) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__rcvr_));
+        }
+      }
+
+      _Receiver __rcvr_;
+      __params<_Scheduler> __params_;
+      std::mutex __mutex_;
+      std::size_t __tokens_;
+      __time_point_t __next_token_{};
+      __intrusive_queue<&__waiter::__next_> __waiting_;
+      bool __timer_active_ = false;
+      bool __cancelled_ = false;
+      bool __done_ = false;
+      bool __stopped_ = false;
+      std::exception_ptr __error_;
+      __optional<__timer_op_t> __timer_op_;
+    };
+
+    template <class _OperationBase, class _Item>
+    struct __forward_fn {
+      auto operator()() -> next_sender_of_t<typename _OperationBase::__receiver_t, _Item> {
+        return exec::set_next(__op_->__rcvr_, static_cast<_Item&&>(__item_));
+      }
+
+      _OperationBase* __op_;
+      _Item __item_;
+    };
+
+    template <class _OperationBase>
+    struct __error_fn {
+      template <class _Error>
+      auto operator()(_Error&& __error) const noexcept {
+        __op_->__store_error(static_cast<_Error&&>(__error));
+        return just_stopped();
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _OperationBase>
+    struct __receiver {
+      using receiver_concept = receiver_t;
+
+      template <sender _Item>
+      auto set_next(_Item&& __item) & noexcept(__nothrow_decay_copyable<_Item>)
+        -> next_sender auto {
+        return STDEXEC::let_error(
+          STDEXEC::let_value(
+            __token_sender<_OperationBase>{__op_},
+            __forward_fn<_OperationBase, __decay_t<_Item>>{__op_, static_cast<_Item&&>(__item)}),
+          __error_fn<_OperationBase>{__op_});
+      }
+
+      void set_value() noexcept {
+        __op_->__input_complete();
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __op_->__store_error(static_cast<_Error&&>(__error));
+        __op_->__input_complete();
+      }
+
+      void set_stopped() noexcept {
+        __op_->__break();
+        __op_->__input_complete();
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _Sequence, class _Receiver, class _Scheduler>
+    struct __operation : __operation_base<_Receiver, _Scheduler> {
+      using __base_t = __operation_base<_Receiver, _Scheduler>;
+      using __receiver_t = __receiver<__base_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, __params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<__params<_Scheduler>&&>(__prms)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Scheduler, class _Sequence>
+      auto operator()(__ignore, __params<_Scheduler> __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Scheduler> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<__params<_Scheduler>&&>(__prms)};
+      }
+    };
+
+    //
+    // throttle is a sequence adaptor that limits the rate at which the items
+    // of a sequence are passed on with a token bucket: it holds up to burst
+    // tokens, one is added every interval on the given timed scheduler, and
+    // every item takes one. Items that find the bucket empty wait, in order,
+    // without blocking a thread, and their next-senders complete only when
+    // the downstream next-senders complete, so the producer is paced. The
+    // interval must be positive and burst must not be 0.
+    //
+    // Waiting items are passed on by a single timer that is armed while some
+    // of them wait. If the timer is stopped by the stop token of the
+    // receiver, the waiting items are stopped.
+    //
+    // The first error of the input sequence, or of forwarding an item, is
+    // delivered as set_error(std::exception_ptr).
+    //
+    struct throttle_t {
+      template <sender _Sequence, timed_scheduler _Scheduler>
+      auto operator()(
+        _Sequence&& __sndr,
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __interval,
+        std::size_t __burst = 1) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        // __refill divides by the interval to count the tokens that are due.
+        [[maybe_unused]]
+        const bool __positive = __interval > duration_of_t<_Scheduler>{};
+        STDEXEC_ASSERT(__burst != 0 && __positive);
+        return make_sequence_expr<throttle_t>(
+          __params<_Scheduler>{static_cast<_Scheduler&&>(__sched), __interval, __burst},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __interval,
+        std::size_t __burst = 1) const noexcept {
+        return __closure(*this, static_cast<_Scheduler&&>(__sched), __interval, __burst);
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, throttle_t>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, throttle_t>);
+        return exec::get_item_types<__child_of<_Self>, _Env...>();
+      }
+
+      template <sender_expr_for<throttle_t> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<throttle_t> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+  } // namespace __throttle
+
+  using __throttle::throttle_t;
+  inline constexpr throttle_t throttle{};
+} // namespace exec
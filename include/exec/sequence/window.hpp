@@ -0,0 +1,522 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+#include "../timed_scheduler.hpp"
+#include "../variant_sender.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "./__detail/__buffered.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__meta.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  struct _WINDOW_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_ { };
+
+  namespace __window {
+    using namespace STDEXEC;
+
+    template <class _Value>
+    using __window_sender_t = __call_result_t<just_t, std::vector<_Value>>;
+
+    using __buffered::__value_of_t;
+
+    template <class _Receiver, class _Value>
+    struct __count_operation_base;
+
+    template <class _Receiver, class _Value, class _Scheduler>
+    struct __time_operation_base;
+
+    struct __count_params {
+      template <class _Receiver, class _Value>
+      using __operation_base_t = __count_operation_base<_Receiver, _Value>;
+
+      std::size_t __size_;
+      std::size_t __step_;
+    };
+
+    template <class _Scheduler>
+    struct __time_params {
+      template <class _Receiver, class _Value>
+      using __operation_base_t = __time_operation_base<_Receiver, _Value, _Scheduler>;
+
+      _Scheduler __sched_;
+      duration_of_t<_Scheduler> __size_;
+      duration_of_t<_Scheduler> __step_;
+    };
+
+    //
+    // A window is emitted as soon as it holds __size_ values. The next-sender
+    // of the item that completes a window is the downstream next-sender of
+    // that window, so a slow consumer holds back the producer. When the input
+    // sequence completes, the values that have not been part of any window
+    // yet are emitted as a final, shorter window.
+    //
+    template <class _Receiver, class _Value>
+    struct __count_operation_base : __buffered::__operation_common<_Receiver> {
+      using __base_t = __buffered::__operation_common<_Receiver>;
+      using __value_t = _Value;
+      using __next_sender_t = next_sender_of_t<_Receiver, __window_sender_t<_Value>>;
+      using __push_result_t =
+        variant_sender<__call_result_t<just_t>, __call_result_t<just_stopped_t>, __next_sender_t>;
+      using __flush_receiver_t = __buffered::__flush_receiver<_Receiver, __count_operation_base>;
+      using __flush_op_t = connect_result_t<__next_sender_t, __flush_receiver_t>;
+
+      __count_operation_base(_Receiver __rcvr, __count_params __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr)}
+        , __size_{__prms.__size_}
+        , __step_{__prms.__step_} {
+      }
+
+      auto __push(_Value __value) -> __push_result_t {
+        std::vector<_Value> __full;
+        {
+          std::scoped_lock __lock{this->__mutex_};
+          if (this->__broken_) {
+            return just_stopped();
+          }
+          if (__skip_ != 0) {
+            // The value falls between two windows.
+            --__skip_;
+            return just();
+          }
+          __buffer_.push_back(static_cast<_Value&&>(__value));
+          ++__fresh_;
+          if (__buffer_.size() < __size_) {
+            return just();
+          }
+          __fresh_ = 0;
+          if (__step_ >= __size_) {
+            __full.assign(
+              std::make_move_iterator(__buffer_.begin()), std::make_move_iterator(__buffer_.end()));
+            __buffer_.clear();
+            __skip_ = __step_ - __size_;
+          } else {
+            __full.assign(__buffer_.begin(), __buffer_.end());
+            __buffer_.erase(
+              __buffer_.begin(), __buffer_.begin() + static_cast<std::ptrdiff_t>(__step_));
+          }
+        }
+        return exec::set_next(this->__rcvr_, just(static_cast<std::vector<_Value>&&>(__full)));
+      }
+
+      // Called when the input sequence has completed. No window is in flight
+      // at this point, because the next-sender of the item that completed it
+      // has completed before the input sequence.
+      void __input_complete() noexcept {
+        std::vector<_Value> __rest;
+        {
+          std::scoped_lock __lock{this->__mutex_};
+          if (!this->__broken_ && __fresh_ != 0) {
+            __rest.assign(
+              std::make_move_iterator(__buffer_.begin()), std::make_move_iterator(__buffer_.end()));
+          }
+          __buffer_.clear();
+        }
+        if (__rest.empty()) {
+          this->__complete();
+          return;
+        }
+        STDEXEC_TRY {
+          __flush_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(this->__rcvr_, just(static_cast<std::vector<_Value>&&>(__rest))),
+            __flush_receiver_t{this});
+          STDEXEC::start(*__flush_op_);
+        }
+        STDEXEC_CATCH_ALL {
+          this->__store_error(std::current_exception());
+          this->__complete();
+        }
+      }
+
+      // Called when the final window has been consumed.
+      void __step() noexcept {
+        this->__complete();
+      }
+
+      std::size_t __size_;
+      std::size_t __step_;
+      std::deque<_Value> __buffer_;
+      std::size_t __fresh_ = 0;
+      std::size_t __skip_ = 0;
+      __optional<__flush_op_t> __flush_op_;
+    };
+
+    //
+    // Windows are laid out on a grid that starts when the operation is
+    // started: the k-th window covers [t0 + k * step, t0 + k * step + size).
+    // Every value is stamped with the time of its arrival, and a timer loop,
+    // which runs while values are buffered, emits each window when its end
+    // is reached. Empty windows are not emitted. Once the input sequence has
+    // completed, the window that is still open is emitted if it holds values
+    // that have not been emitted yet, and the operation completes.
+    //
+    template <class _Receiver, class _Value, class _Scheduler>
+    struct __time_operation_base
+      : __buffered::__timer_loop<
+          __time_operation_base<_Receiver, _Value, _Scheduler>,
+          _Receiver,
+          _Scheduler,
+          std::vector<_Value>
+        > {
+      using __base_t = __buffered::__timer_loop<
+        __time_operation_base,
+        _Receiver,
+        _Scheduler,
+        std::vector<_Value>
+      >;
+      using __value_t = _Value;
+      using typename __base_t::__time_point_t;
+      using typename __base_t::__duration_t;
+      using __push_result_t = variant_sender<
+        __call_result_t<just_t>,
+        __call_result_t<just_stopped_t>,
+        typename __base_t::__next_sender_t
+      >;
+
+      struct __entry {
+        __time_point_t __time_;
+        _Value __value_;
+      };
+
+      __time_operation_base(_Receiver __rcvr, __time_params<_Scheduler> __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<_Scheduler&&>(__prms.__sched_)}
+        , __size_{__prms.__size_}
+        , __step_{__prms.__step_} {
+      }
+
+      void __start_clock() noexcept {
+        __deadline_ = exec::now(this->__sched_) + __size_;
+      }
+
+      auto __push(_Value __value) -> __push_result_t {
+        bool __start_timer = false;
+        __duration_t __wait{};
+        {
+          std::scoped_lock __lock{this->__mutex_};
+          if (this->__broken_) {
+            return just_stopped();
+          }
+          auto __now = exec::now(this->__sched_);
+          if (!this->__loop_active_ && __now >= __deadline_) {
+            // Skip the windows that have closed while the loop was idle.
+            auto __late = (__now - __deadline_) / __step_ + 1;
+            __deadline_ += __late * __step_;
+          }
+          if (__now < __deadline_ - __size_) {
+            // The value falls between two windows.
+            return just();
+          }
+          __buffer_.push_back(__entry{__now, static_cast<_Value&&>(__value)});
+          if (this->__activate()) {
+            __start_timer = true;
+            __wait = __deadline_ - __now;
+          }
+        }
+        if (__start_timer) {
+          this->__arm_timer(__wait);
+        }
+        return just();
+      }
+
+      // Called by the timer loop with the lock held.
+      auto __poll(__optional<std::vector<_Value>>& __full, __duration_t& __wait)
+        -> __buffered::__action_t {
+        if (this->__broken_) {
+          __buffer_.clear();
+        }
+        while (!__buffer_.empty()) {
+          if (this->__done_) {
+            if (__full.emplace(__take_final()).empty()) {
+              break;
+            }
+            return __buffered::__action_t::__flush;
+          }
+          auto __now = exec::now(this->__sched_);
+          if (__now < __deadline_) {
+            __wait = __deadline_ - __now;
+            return __buffered::__action_t::__arm;
+          }
+          if (!__full.emplace(__take_window()).empty()) {
+            return __buffered::__action_t::__flush;
+          }
+        }
+        return __buffered::__action_t::__idle;
+      }
+
+      // Takes the values of the window that ends at __deadline_, and advances
+      // __deadline_ to the end of the next window.
+      auto __take_window() -> std::vector<_Value> {
+        auto __begin = __deadline_ - __size_;
+        std::vector<_Value> __full;
+        for (auto& __e: __buffer_) {
+          if (__e.__time_ >= __begin && __e.__time_ < __deadline_) {
+            if (__step_ >= __size_) {
+              // The value cannot be part of a later window.
+              __full.push_back(static_cast<_Value&&>(__e.__value_));
+            } else {
+              __full.push_back(__e.__value_);
+            }
+          }
+        }
+        __deadline_ += __step_;
+        __begin = __deadline_ - __size_;
+        while (!__buffer_.empty() && __buffer_.front().__time_ < __begin) {
+          __buffer_.pop_front();
+        }
+        __last_emitted_ = __deadline_ - __step_;
+        return __full;
+      }
+
+      // Takes the values of the open window once the input has completed,
+      // provided that some of them have not been emitted yet.
+      auto __take_final() -> std::vector<_Value> {
+        std::vector<_Value> __full;
+        if (!__buffer_.empty() && __buffer_.back().__time_ >= __last_emitted_) {
+          auto __begin = __deadline_ - __size_;
+          for (auto& __e: __buffer_) {
+            if (__e.__time_ >= __begin) {
+              __full.push_back(static_cast<_Value&&>(__e.__value_));
+            }
+          }
+        }
+        __buffer_.clear();
+        return __full;
+      }
+
+      __duration_t __size_;
+      __duration_t __step_;
+      __time_point_t __deadline_{};
+      __time_point_t __last_emitted_{};
+      std::deque<__entry> __buffer_;
+    };
+
+    template <class _Sequence, class _Receiver, class _Params>
+    using __operation_base_for_t = _Params::template __operation_base_t<
+      _Receiver,
+      __value_of_t<_Sequence, env_of_t<_Receiver>>
+    >;
+
+    template <class _Sequence, class _Receiver, class _Params>
+    struct __operation : __operation_base_for_t<_Sequence, _Receiver, _Params> {
+      using __value_t = __value_of_t<_Sequence, env_of_t<_Receiver>>;
+      using __base_t = __operation_base_for_t<_Sequence, _Receiver, _Params>;
+      using __receiver_t = __buffered::__receiver<__base_t>;
+
+      __operation(_Sequence&& __sndr, _Receiver __rcvr, _Params __prms)
+        : __base_t{static_cast<_Receiver&&>(__rcvr), static_cast<_Params&&>(__prms)}
+        , __opstate_{exec::subscribe(static_cast<_Sequence&&>(__sndr), __receiver_t{this})} {
+      }
+
+      void start() & noexcept {
+        if constexpr (requires { this->__start_clock(); }) {
+          this->__start_clock();
+        }
+        STDEXEC::start(__opstate_);
+      }
+
+      subscribe_result_t<_Sequence, __receiver_t> __opstate_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Params, class _Sequence>
+      auto operator()(__ignore, _Params __prms, _Sequence&& __sequence)
+        -> __operation<_Sequence, _Receiver, _Params> {
+        return {
+          static_cast<_Sequence&&>(__sequence),
+          static_cast<_Receiver&&>(__rcvr_),
+          static_cast<_Params&&>(__prms)};
+      }
+    };
+
+    // The sequence sender customizations that count- and time-based windows
+    // have in common.
+    template <class _Tag>
+    struct __window_impl {
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, _Tag>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, _Tag>);
+        auto __child_items = exec::get_item_types<__child_of<_Self>, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _ItemSender>() {
+              return __mtype<__minvoke<__buffered::__item_value_fn<_Env...>, _ItemSender>>();
+            },
+            []<class... _Values>(__mtype<_Values>...) {
+              using __values_t = __minvoke<__munique<__q<__mlist>>, _Values...>;
+              if constexpr (__mapply<__msize, __values_t>::value == 0) {
+                return item_types<>();
+              } else if constexpr (__mapply<__msize, __values_t>::value == 1) {
+                return item_types<__window_sender_t<__mapply<__q<__msingle>, __values_t>>>();
+              } else {
+                return exec::__invalid_item_types<
+                  _WINDOW_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_,
+                  _WITH_PRETTY_SEQUENCE_<__child_of<_Self>>,
+                  __fn_t<_WITH_ENVIRONMENT_, _Env>...
+                >();
+              }
+            });
+        }
+      }
+
+      template <sender_expr_for<_Tag> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+
+      template <sender_expr_for<_Tag> _Sexpr>
+      static auto get_env(const _Sexpr& __sexpr) noexcept -> env_of_t<__child_of<_Sexpr>> {
+        return __apply(
+          []<class _Child>(__ignore, __ignore, const _Child& __child) {
+            return STDEXEC::get_env(__child);
+          },
+          __sexpr);
+      }
+    };
+
+    //
+    // window is a sequence adaptor that groups the values of the items of a
+    // sequence into std::vectors of size values. A new window starts every
+    // step values: the windows are tumbling if step equals size, sliding if
+    // step is smaller, and values between two windows are dropped if step is
+    // larger. The values that have not been part of any window when the input
+    // sequence completes are emitted as a final, shorter window.
+    //
+    // The next-sender of an item that completes a window completes only when
+    // the downstream next-sender of that window completes, so a slow consumer
+    // holds back the producer.
+    //
+    // Errors are handled as in exec::batch.
+    //
+    struct window_t : __window_impl<window_t> {
+      template <sender _Sequence>
+      auto operator()(_Sequence&& __sndr, std::size_t __size, std::size_t __step) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        STDEXEC_ASSERT(__size != 0 && __step != 0);
+        return make_sequence_expr<window_t>(
+          __count_params{__size, __step}, static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <sender _Sequence>
+      auto operator()(_Sequence&& __sndr, std::size_t __size) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        return (*this)(static_cast<_Sequence&&>(__sndr), __size, __size);
+      }
+
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(std::size_t __size, std::size_t __step) const noexcept {
+        return __closure(*this, __size, __step);
+      }
+
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(std::size_t __size) const noexcept {
+        return __closure(*this, __size, __size);
+      }
+    };
+
+    //
+    // timed_window is a sequence adaptor that groups the values of the items
+    // of a sequence into std::vectors by their time of arrival on the given
+    // timed scheduler. The windows start every step, beginning when the
+    // operation is started, and each covers size: they are tumbling if step
+    // equals size, sliding if step is smaller, and values that arrive between
+    // two windows are dropped if step is larger. Both durations must be
+    // positive.
+    //
+    // A window is emitted when it ends, unless it is empty. Once the input
+    // sequence completes, the open window is emitted without waiting for its
+    // end if it holds values that have not been emitted yet.
+    //
+    // Errors are handled as in exec::batch, and buffered values are
+    // discarded.
+    //
+    struct timed_window_t : __window_impl<timed_window_t> {
+      template <sender _Sequence, timed_scheduler _Scheduler>
+      auto operator()(
+        _Sequence&& __sndr,
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __size,
+        duration_of_t<_Scheduler> __step) const
+        noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        // __push divides by the step to skip the windows that closed while idle.
+        [[maybe_unused]]
+        const bool __positive =
+          __size > duration_of_t<_Scheduler>{} && __step > duration_of_t<_Scheduler>{};
+        STDEXEC_ASSERT(__positive);
+        return make_sequence_expr<timed_window_t>(
+          __time_params<_Scheduler>{static_cast<_Scheduler&&>(__sched), __size, __step},
+          static_cast<_Sequence&&>(__sndr));
+      }
+
+      template <sender _Sequence, timed_scheduler _Scheduler>
+      auto operator()(_Sequence&& __sndr, _Scheduler __sched, duration_of_t<_Scheduler> __size)
+        const noexcept(__nothrow_decay_copyable<_Sequence>) -> __well_formed_sequence_sender auto {
+        return (*this)(
+          static_cast<_Sequence&&>(__sndr), static_cast<_Scheduler&&>(__sched), __size, __size);
+      }
+
+      template <timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto operator()(
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __size,
+        duration_of_t<_Scheduler> __step) const noexcept {
+        return __closure(*this, static_cast<_Scheduler&&>(__sched), __size, __step);
+      }
+
+      template <timed_scheduler _Scheduler>
+      STDEXEC_ATTRIBUTE(always_inline)
+      constexpr auto
+        operator()(_Scheduler __sched, duration_of_t<_Scheduler> __size) const noexcept {
+        return __closure(*this, static_cast<_Scheduler&&>(__sched), __size, __size);
+      }
+    };
+  } // namespace __window
+
+  using __window::window_t;
+  inline constexpr window_t window{};
+
+  using __window::timed_window_t;
+  inline constexpr timed_window_t timed_window{};
+} // namespace exec
@@ -0,0 +1,681 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+
+#include "../__detail/__basic_sequence.hpp"
+#include "./__detail/__buffered.hpp"
+#include "stdexec/__detail/__diagnostics.hpp"
+#include "stdexec/__detail/__intrusive_queue.hpp"
+#include "stdexec/__detail/__meta.hpp"
+#include "stdexec/__detail/__optional.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <tuple>
+#include <utility>
+
+namespace exec {
+  struct _ZIP_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_ { };
+
+  namespace __zip {
+    using namespace STDEXEC;
+
+    struct zip_t;
+    struct combine_latest_t;
+
+    template <class... _Values>
+    using __zip_sender_t = __call_result_t<just_t, std::tuple<_Values...>>;
+
+    using __buffered::__value_of_t;
+
+    // Everything that happens to a zip operation is posted to it as an event:
+    // the value of an item has arrived, an item has failed, the downstream
+    // receiver has consumed an emitted tuple, or a source has completed.
+    struct __event {
+      enum class __kind_t : unsigned char {
+        __arrival,
+        __break,
+        __consumed,
+        __source_done
+      };
+
+      __event() = default;
+
+      __event(__kind_t __kind, std::size_t __index) noexcept
+        : __kind_{__kind}
+        , __index_{__index} {
+      }
+
+      __kind_t __kind_ = __kind_t::__arrival;
+      std::size_t __index_ = 0;
+      bool __stopped_ = false;
+      std::exception_ptr __error_{};
+      __event* __next_ = nullptr;
+    };
+
+    // An event whose sender waits until the operation resumes it. The
+    // next-sender of an item completes when its waiter is resumed, which is
+    // how zip holds back producers that are ahead of the others.
+    struct __waiter : __event {
+      using __event::__event;
+
+      void (*__resume_)(__waiter*, bool __stopped) noexcept = nullptr;
+    };
+
+    template <class _Value>
+    struct __arrival : __waiter {
+      __arrival(std::size_t __index, _Value&& __value)
+        : __waiter{__kind_t::__arrival, __index}
+        , __value_{static_cast<_Value&&>(__value)} {
+      }
+
+      _Value __value_;
+    };
+
+    template <class _Waiter, class _OperationBase, class _Receiver>
+    struct __waiter_operation : _Waiter {
+      __waiter_operation(_Waiter&& __waiter, _OperationBase* __op, _Receiver __rcvr)
+        : _Waiter{static_cast<_Waiter&&>(__waiter)}
+        , __op_{__op}
+        , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        this->__resume_ = &__resume;
+      }
+
+      __waiter_operation(__waiter_operation&&) = delete;
+
+      void start() & noexcept {
+        __op_->__post(this);
+      }
+
+      static void __resume(__waiter* __self, bool __stopped) noexcept {
+        auto* __op = static_cast<__waiter_operation*>(__self);
+        if (__stopped) {
+          STDEXEC::set_stopped(static_cast<_Receiver&&>(__op->__rcvr_));
+        } else {
+          STDEXEC::set_value(static_cast<_Receiver&&>(__op->__rcvr_));
+        }
+      }
+
+      _OperationBase* __op_;
+      _Receiver __rcvr_;
+    };
+
+    template <class _Waiter, class _OperationBase>
+    struct __waiter_sender {
+      using sender_concept = sender_t;
+      using completion_signatures =
+        STDEXEC::completion_signatures<set_value_t(), set_stopped_t()>;
+
+      template <receiver _Receiver>
+      auto connect(_Receiver __rcvr) && noexcept(__nothrow_move_constructible<_Waiter>)
+        -> __waiter_operation<_Waiter, _OperationBase, _Receiver> {
+        return {static_cast<_Waiter&&>(__waiter_), __op_, static_cast<_Receiver&&>(__rcvr)};
+      }
+
+      _Waiter __waiter_;
+      _OperationBase* __op_;
+    };
+
+    template <class _OperationBase>
+    struct __consumed_receiver {
+      using receiver_concept = receiver_t;
+
+      void set_value() noexcept {
+        __op_->__post_consumed(false);
+      }
+
+      void set_stopped() noexcept {
+        __op_->__post_consumed(true);
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _OperationBase* __op_;
+    };
+
+    // zip keeps the arrivals of each source in a slot of its own. A slot
+    // holds at most one value unless its source emits items concurrently.
+    template <std::size_t _Size>
+    struct __zip_state {
+      std::array<__intrusive_queue<&__event::__next_>, _Size> __slots_{};
+      std::array<__waiter*, _Size> __current_{};
+    };
+
+    // combine_latest handles the arrivals of all sources in order and keeps
+    // the latest value of each source.
+    template <class... _Values>
+    struct __latest_state {
+      __intrusive_queue<&__event::__next_> __arrivals_{};
+      __waiter* __current_ = nullptr;
+      std::tuple<__optional<_Values>...> __latest_{};
+    };
+
+    //
+    // The state of a zip or combine_latest operation is owned by whichever
+    // thread runs its event loop. Events are posted to a lock-free stack,
+    // and the thread that posts to an idle stack runs the loop until no
+    // events are left. Posting is the last access of a producer to the
+    // operation, and events that are posted while the loop runs, including
+    // from within the loop, are handled by the running loop, so neither
+    // producers nor the loop ever wait for a lock.
+    //
+    template <class _Receiver, class _Tag, class... _Values>
+    struct __operation_base {
+      using __receiver_t = _Receiver;
+      using __item_t = std::tuple<_Values...>;
+      using __next_sender_t = next_sender_of_t<_Receiver, __zip_sender_t<_Values...>>;
+      using __emit_op_t = connect_result_t<__next_sender_t, __consumed_receiver<__operation_base>>;
+      using __state_t = __if_c<
+        __same_as<_Tag, zip_t>,
+        __zip_state<sizeof...(_Values)>,
+        __latest_state<_Values...>
+      >;
+
+      template <std::size_t _Index>
+      using __value_t = __m_at_c<_Index, _Values...>;
+
+      static constexpr std::size_t __size = sizeof...(_Values);
+
+      explicit __operation_base(_Receiver __rcvr)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        for (std::size_t __i = 0; __i < __size; ++__i) {
+          __source_events_[__i] = __event{__event::__kind_t::__source_done, __i};
+        }
+      }
+
+      void __post(__event* __ev) noexcept {
+        __event* __old = __head_.load(std::memory_order_relaxed);
+        do {
+          __ev->__next_ = __old;
+        } while (!__head_.compare_exchange_weak(
+          __old, __ev, std::memory_order_acq_rel, std::memory_order_relaxed));
+        if (__old == nullptr) {
+          __run();
+        }
+      }
+
+      void __post_consumed(bool __stopped) noexcept {
+        __consumed_event_.__stopped_ = __stopped;
+        __post(&__consumed_event_);
+      }
+
+      template <std::size_t _Index, class _Error>
+      void __post_source_done(bool __stopped, _Error&& __error) noexcept {
+        __event& __ev = __source_events_[_Index];
+        __ev.__stopped_ = __stopped;
+        if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+          __ev.__error_ = static_cast<_Error&&>(__error);
+        } else if constexpr (!__same_as<__decay_t<_Error>, __ignore>) {
+          __ev.__error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+        }
+        __post(&__ev);
+      }
+
+      // The loop leaves the stack holding &__running_ while it handles a batch
+      // of events, so that producers can tell that it is running.
+      void __run() noexcept {
+        while (true) {
+          __event* __list = __head_.exchange(&__running_, std::memory_order_acq_rel);
+          __event* __batch = nullptr;
+          while (__list != nullptr && __list != &__running_) {
+            __event* __next = std::exchange(__list->__next_, __batch);
+            __batch = std::exchange(__list, __next);
+          }
+          while (__batch != nullptr) {
+            __handle(*std::exchange(__batch, __batch->__next_));
+          }
+          __advance();
+          if (__done_sources_ == __size) {
+            // No event can be posted anymore: every item of every source has
+            // been resumed and the last emitted tuple has been consumed.
+            __complete();
+            return;
+          }
+          __event* __expected = &__running_;
+          if (__head_.compare_exchange_strong(
+                __expected, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+          }
+        }
+      }
+
+      void __handle(__event& __ev) noexcept {
+        __ev.__next_ = nullptr;
+        switch (__ev.__kind_) {
+        case __event::__kind_t::__arrival:
+          if (__broken_) {
+            __resume(static_cast<__waiter*>(&__ev), true);
+          } else if constexpr (__same_as<_Tag, zip_t>) {
+            __state_.__slots_[__ev.__index_].push_back(&__ev);
+          } else {
+            __state_.__arrivals_.push_back(&__ev);
+          }
+          break;
+        case __event::__kind_t::__break:
+          __store_error(static_cast<std::exception_ptr&&>(__ev.__error_));
+          __broken_ = true;
+          __resume(static_cast<__waiter*>(&__ev), true);
+          break;
+        case __event::__kind_t::__consumed:
+          __consumed(__ev.__stopped_);
+          break;
+        case __event::__kind_t::__source_done:
+        {
+          ++__done_sources_;
+          bool __failed = __ev.__error_ || __ev.__stopped_;
+          if (__ev.__error_) {
+            __store_error(static_cast<std::exception_ptr&&>(__ev.__error_));
+          } else if (__ev.__stopped_ && !__broken_) {
+            __stopped_ = true;
+          }
+          if constexpr (__same_as<_Tag, zip_t>) {
+            // No more tuples can be formed.
+            __broken_ = true;
+          } else if (__failed || !__has_latest(__ev.__index_)) {
+            __broken_ = true;
+          }
+          break;
+        }
+        }
+      }
+
+      // Emits the next tuple if one is ready, or resumes the waiting arrivals
+      // with set_stopped if the operation is broken.
+      void __advance() noexcept {
+        if constexpr (__same_as<_Tag, zip_t>) {
+          if (__broken_) {
+            for (auto& __slot: __state_.__slots_) {
+              __resume_all(__slot);
+            }
+          } else if (!__emitting_) {
+            bool __ready = true;
+            for (auto& __slot: __state_.__slots_) {
+              __ready = __ready && !__slot.empty();
+            }
+            if (__ready) {
+              for (std::size_t __i = 0; __i < __size; ++__i) {
+                auto* __front = __state_.__slots_[__i].pop_front();
+                __state_.__current_[__i] = static_cast<__waiter*>(__front);
+              }
+              __emit([this]<std::size_t... _Is>(__indices<_Is...>) {
+                return __item_t{static_cast<_Values&&>(
+                  static_cast<__arrival<_Values>*>(__state_.__current_[_Is])->__value_)...};
+              });
+            }
+          }
+        } else {
+          while (!__broken_ && !__emitting_ && !__state_.__arrivals_.empty()) {
+            auto* __next = static_cast<__waiter*>(__state_.__arrivals_.pop_front());
+            if (__take_latest(__next)) {
+              __state_.__current_ = __next;
+              __emit([this]<std::size_t... _Is>(__indices<_Is...>) {
+                return __item_t{*std::get<_Is>(__state_.__latest_)...};
+              });
+            } else {
+              __resume(__next, false);
+            }
+          }
+          if (__broken_) {
+            __resume_all(__state_.__arrivals_);
+          }
+        }
+      }
+
+      // Stores the value of the arrival as the latest value of its source.
+      // Returns true if every source has a latest value.
+      auto __take_latest(__waiter* __next) noexcept -> bool {
+        return [&]<std::size_t... _Is>(__indices<_Is...>) {
+          STDEXEC_TRY {
+            ((__next->__index_ == _Is ? __store_latest<_Is>(__next) : void()), ...);
+          }
+          STDEXEC_CATCH_ALL {
+            __store_error(std::current_exception());
+            __broken_ = true;
+          }
+          return (std::get<_Is>(__state_.__latest_).has_value() && ...);
+        }(__make_indices<__size>{});
+      }
+
+      template <std::size_t _Index>
+      void __store_latest(__waiter* __next) {
+        auto& __value = static_cast<__arrival<__value_t<_Index>>*>(__next)->__value_;
+        std::get<_Index>(__state_.__latest_)
+          .emplace(static_cast<__value_t<_Index>&&>(__value));
+      }
+
+      auto __has_latest(std::size_t __index) const noexcept -> bool {
+        return [&]<std::size_t... _Is>(__indices<_Is...>) {
+          return ((__index == _Is && std::get<_Is>(__state_.__latest_).has_value()) || ...);
+        }(__make_indices<__size>{});
+      }
+
+      template <class _MakeItem>
+      void __emit(_MakeItem __make_item) noexcept {
+        __emitting_ = true;
+        STDEXEC_TRY {
+          __emit_op_.__emplace_from(
+            STDEXEC::connect,
+            exec::set_next(__rcvr_, just(__make_item(__make_indices<__size>{}))),
+            __consumed_receiver<__operation_base>{this});
+          STDEXEC::start(*__emit_op_);
+        }
+        STDEXEC_CATCH_ALL {
+          __store_error(std::current_exception());
+          __consumed(true);
+        }
+      }
+
+      // Resumes the arrivals of the last emitted tuple.
+      void __consumed(bool __stopped) noexcept {
+        __emitting_ = false;
+        if (__stopped) {
+          __stopped_ = __stopped_ || !__broken_;
+          __broken_ = true;
+        }
+        if constexpr (__same_as<_Tag, zip_t>) {
+          for (auto& __current: __state_.__current_) {
+            __resume(std::exchange(__current, nullptr), __stopped);
+          }
+        } else {
+          __resume(std::exchange(__state_.__current_, nullptr), __stopped);
+        }
+      }
+
+      static void __resume(__waiter* __wtr, bool __stopped) noexcept {
+        if (__wtr != nullptr) {
+          __wtr->__resume_(__wtr, __stopped);
+        }
+      }
+
+      static void __resume_all(__intrusive_queue<&__event::__next_>& __queue) noexcept {
+        while (!__queue.empty()) {
+          __resume(static_cast<__waiter*>(__queue.pop_front()), true);
+        }
+      }
+
+      void __store_error(std::exception_ptr&& __error) noexcept {
+        if (__error && !__error_) {
+          __error_ = static_cast<std::exception_ptr&&>(__error);
+        }
+      }
+
+      void __complete() noexcept {
+        __buffered::__complete_receiver(__rcvr_, __error_, __stopped_);
+      }
+
+      _Receiver __rcvr_;
+      std::atomic<__event*> __head_{nullptr};
+      __event __running_{};
+      __event __consumed_event_{__event::__kind_t::__consumed, 0};
+      std::array<__event, __size> __source_events_{};
+      __state_t __state_{};
+      bool __emitting_ = false;
+      bool __broken_ = false;
+      bool __stopped_ = false;
+      std::size_t __done_sources_ = 0;
+      std::exception_ptr __error_{};
+      __optional<__emit_op_t> __emit_op_{};
+    };
+
+    template <class _OperationBase, std::size_t _Index>
+    struct __arrive_fn {
+      using __value_t = _OperationBase::template __value_t<_Index>;
+      using __sender_t = __waiter_sender<__arrival<__value_t>, _OperationBase>;
+
+      template <class... _Args>
+      auto operator()(_Args&&... __args) const -> __sender_t {
+        return {
+          __arrival<__value_t>{_Index, __value_t(static_cast<_Args&&>(__args)...)},
+          __op_
+        };
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _OperationBase>
+    struct __break_fn {
+      template <class _Error>
+      auto operator()(_Error&& __error) const noexcept
+        -> __waiter_sender<__waiter, _OperationBase> {
+        __waiter __wtr{__event::__kind_t::__break, 0};
+        if constexpr (__same_as<__decay_t<_Error>, std::exception_ptr>) {
+          __wtr.__error_ = static_cast<_Error&&>(__error);
+        } else {
+          __wtr.__error_ = std::make_exception_ptr(static_cast<_Error&&>(__error));
+        }
+        return {static_cast<__waiter&&>(__wtr), __op_};
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _OperationBase, std::size_t _Index>
+    struct __source_receiver {
+      using receiver_concept = receiver_t;
+
+      template <sender _Item>
+      auto set_next(_Item&& __item) & noexcept(__nothrow_decay_copyable<_Item>)
+        -> next_sender auto {
+        return STDEXEC::let_error(
+          STDEXEC::let_value(
+            static_cast<_Item&&>(__item), __arrive_fn<_OperationBase, _Index>{__op_}),
+          __break_fn<_OperationBase>{__op_});
+      }
+
+      void set_value() noexcept {
+        __op_->template __post_source_done<_Index>(false, __ignore{});
+      }
+
+      template <class _Error>
+      void set_error(_Error&& __error) noexcept {
+        __op_->template __post_source_done<_Index>(false, static_cast<_Error&&>(__error));
+      }
+
+      void set_stopped() noexcept {
+        __op_->template __post_source_done<_Index>(true, __ignore{});
+      }
+
+      auto get_env() const noexcept -> env_of_t<typename _OperationBase::__receiver_t> {
+        return STDEXEC::get_env(__op_->__rcvr_);
+      }
+
+      _OperationBase* __op_;
+    };
+
+    template <class _Receiver, class _Tag, class... _Sequences>
+    using __operation_base_for_t =
+      __operation_base<_Receiver, _Tag, __value_of_t<_Sequences, env_of_t<_Receiver>>...>;
+
+    template <class _Receiver, class _Tag, class... _Sequences>
+    struct __operation : __operation_base_for_t<_Receiver, _Tag, _Sequences...> {
+      using __base_t = __operation_base_for_t<_Receiver, _Tag, _Sequences...>;
+
+      template <std::size_t... _Is>
+      static auto __subscribe_all(__base_t* __op, __indices<_Is...>, _Sequences&&... __sequences)
+        -> __tuple<subscribe_result_t<_Sequences, __source_receiver<__base_t, _Is>>...> {
+        return __tuple{exec::subscribe(
+          static_cast<_Sequences&&>(__sequences), __source_receiver<__base_t, _Is>{__op})...};
+      }
+
+      __operation(_Receiver __rcvr, _Sequences&&... __sequences)
+        : __base_t{static_cast<_Receiver&&>(__rcvr)}
+        , __source_ops_{__subscribe_all(
+            this,
+            __indices_for<_Sequences...>{},
+            static_cast<_Sequences&&>(__sequences)...)} {
+      }
+
+      void start() & noexcept {
+        STDEXEC::__apply(
+          [](auto&... __ops) noexcept { (STDEXEC::start(__ops), ...); }, __source_ops_);
+      }
+
+      decltype(__subscribe_all(
+        nullptr,
+        __indices_for<_Sequences...>{},
+        __declval<_Sequences>()...)) __source_ops_;
+    };
+
+    template <class _Receiver>
+    struct __subscribe_fn {
+      _Receiver& __rcvr_;
+
+      template <class _Tag, class... _Sequences>
+      auto operator()(_Tag, __ignore, _Sequences&&... __sequences)
+        -> __operation<_Receiver, _Tag, _Sequences...> {
+        return {static_cast<_Receiver&&>(__rcvr_), static_cast<_Sequences&&>(__sequences)...};
+      }
+    };
+
+    template <class _First, class... _Rest>
+    consteval auto __first_error(_First __first, _Rest... __rest) {
+      if constexpr (STDEXEC::__merror<_First>) {
+        return __first;
+      } else {
+        return __zip::__first_error(__rest...);
+      }
+    }
+
+    // The sequence sender customizations that zip and combine_latest have in
+    // common.
+    template <class _Tag>
+    struct __zip_impl {
+      // The value type of the items of _Child as __mtype<_Value>, __mtype<__>
+      // if it has no items, or an error.
+      template <class _Child, class... _Env>
+      static consteval auto __value_type_of() {
+        auto __child_items = exec::get_item_types<_Child, _Env...>();
+
+        if constexpr (STDEXEC::__merror<decltype(__child_items)>) {
+          return exec::__invalid_item_types(__child_items);
+        } else {
+          return __child_items.__transform(
+            []<class _ItemSender>() {
+              return __mtype<__minvoke<__buffered::__item_value_fn<_Env...>, _ItemSender>>();
+            },
+            []<class... _Values>(__mtype<_Values>...) {
+              using __values_t = __minvoke<__munique<__q<__mlist>>, _Values...>;
+              if constexpr (__mapply<__msize, __values_t>::value == 0) {
+                return __mtype<__>();
+              } else if constexpr (__mapply<__msize, __values_t>::value == 1) {
+                return __mtype<__mapply<__q<__msingle>, __values_t>>();
+              } else {
+                return exec::__invalid_item_types<
+                  _ZIP_REQUIRES_ITEMS_OF_A_SINGLE_VALUE_TYPE_,
+                  _WITH_PRETTY_SEQUENCE_<_Child>,
+                  __fn_t<_WITH_ENVIRONMENT_, _Env>...
+                >();
+              }
+            });
+        }
+      }
+
+      template <class... _Results>
+      static consteval auto __item_types_from(_Results... __results) {
+        if constexpr ((STDEXEC::__merror<_Results> || ...)) {
+          return __zip::__first_error(__results...);
+        } else if constexpr ((__same_as<_Results, __mtype<__>> || ...)) {
+          return item_types<>();
+        } else {
+          return item_types<__zip_sender_t<__t<_Results>...>>();
+        }
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_completion_signatures() {
+        static_assert(sender_expr_for<_Self, _Tag>);
+        return completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()
+        >();
+      }
+
+      template <class _Self, class... _Env>
+      static consteval auto get_item_types() {
+        static_assert(sender_expr_for<_Self, _Tag>);
+        return []<class... _Children>(__mlist<_Children...>*) {
+          return __item_types_from(__value_type_of<_Children, _Env...>()...);
+        }(static_cast<__children_of<_Self>*>(nullptr));
+      }
+
+      template <sender_expr_for<_Tag> _Self, receiver _Receiver>
+      static auto subscribe(_Self&& __self, _Receiver __rcvr)
+        -> __apply_result_t<__subscribe_fn<_Receiver>, _Self> {
+        return __apply(__subscribe_fn<_Receiver>{__rcvr}, static_cast<_Self&&>(__self));
+      }
+    };
+
+    //
+    // zip is a sequence factory that pairs up the items of its input
+    // sequences. It emits a std::tuple of the values of the next item of
+    // each input as soon as all of them have arrived, and ends when one of
+    // the inputs has completed and its items have been paired.
+    //
+    // The value of an item is held in a single slot until it has been
+    // emitted, and the next-sender of the item completes only when the
+    // downstream next-sender of its tuple completes, so inputs that are
+    // ahead of the others wait for them instead of being buffered. The
+    // remaining inputs are stopped by completing their next-senders with
+    // set_stopped.
+    //
+    // The items of each input must complete with values of a single type.
+    // The first error of an item or of an input is stored, stops all
+    // inputs, and is delivered as set_error(std::exception_ptr).
+    //
+    struct zip_t : __zip_impl<zip_t> {
+      template <sender... _Sequences>
+        requires(sizeof...(_Sequences) != 0)
+      auto operator()(_Sequences&&... __sequences) const
+        noexcept(__nothrow_decay_copyable<_Sequences...>) -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<zip_t>({}, static_cast<_Sequences&&>(__sequences)...);
+      }
+    };
+
+    //
+    // combine_latest is a sequence factory that emits a std::tuple of the
+    // latest values of its input sequences whenever one of them produces an
+    // item, once each of them has produced one. It ends when all inputs have
+    // completed, or when an input completes without producing any item.
+    //
+    // Arrivals are handled one at a time, and the next-sender of an item that
+    // causes a tuple to be emitted completes only when the downstream
+    // next-sender of that tuple completes. The values must be copyable.
+    //
+    struct combine_latest_t : __zip_impl<combine_latest_t> {
+      template <sender... _Sequences>
+        requires(sizeof...(_Sequences) != 0)
+      auto operator()(_Sequences&&... __sequences) const
+        noexcept(__nothrow_decay_copyable<_Sequences...>) -> __well_formed_sequence_sender auto {
+        return make_sequence_expr<combine_latest_t>({}, static_cast<_Sequences&&>(__sequences)...);
+      }
+    };
+  } // namespace __zip
+
+  using __zip::zip_t;
+  inline constexpr zip_t zip{};
+
+  using __zip::combine_latest_t;
+  inline constexpr combine_latest_t combine_latest{};
+} // namespace exec
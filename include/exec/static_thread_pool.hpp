@@ -26,8 +26,10 @@
 #include "__detail/__atomic_intrusive_queue.hpp"
 #include "__detail/__bwos_lifo_queue.hpp"
 #include "__detail/__numa.hpp"
+#include "__detail/__trace.hpp"
 #include "__detail/__xorshift.hpp"
 
+#include "env.hpp"
 #include "sequence/iterate.hpp"
 #include "sequence_senders.hpp"
 
@@ -87,7 +89,7 @@ namespace exec {
 
 #if STDEXEC_HAS_STD_RANGES()
     namespace schedule_all_ {
-      template <class Range>
+      template <class Range, bool Chunked = false>
       class sequence;
     } // namespace schedule_all_
 #endif
@@ -165,7 +167,7 @@ namespace exec {
       }
     };
 
-    class _static_thread_pool {
+    class STDEXEC_TRACE_ABI_TAG _static_thread_pool {
       template <class Receiver>
       struct _opstate;
 
@@ -415,6 +417,11 @@ namespace exec {
           return forward_progress_guarantee::parallel;
         }
 
+        [[nodiscard]]
+        auto query(get_available_parallelism_t) const noexcept -> std::size_t {
+          return pool_->available_parallelism();
+        }
+
         [[nodiscard]]
         auto query(get_completion_domain_t<set_value_t>, __ignore = {}) const noexcept -> domain {
           return {};
@@ -724,6 +731,7 @@ namespace exec {
         if (!task) {
           return; // pop() only returns null when request_stop() was called.
         }
+        STDEXEC_TRACE(dequeue, task);
         task->execute_(task, queue_index);
       }
     }
@@ -804,6 +812,7 @@ namespace exec {
       remote_queue& queue,
       task_base* task,
       const nodemask& constraints) noexcept {
+      STDEXEC_TRACE(enqueue, task);
       static thread_local std::thread::id this_id = std::this_thread::get_id();
       remote_queue* correct_queue = this_id == queue.id_ ? &queue : get_remote_queue();
       std::size_t idx = correct_queue->index_;
@@ -824,6 +833,7 @@ namespace exec {
       remote_queue& queue,
       task_base* task,
       std::size_t thread_index) noexcept {
+      STDEXEC_TRACE(enqueue, task);
       thread_index %= thread_count_;
       queue.queues_[thread_index].push_front(task);
       thread_states_[thread_index]->notify();
@@ -834,6 +844,7 @@ namespace exec {
       auto& queue = *this->get_remote_queue();
       for (std::uint32_t i = 0; i < tasks.size(); ++i) {
         std::uint32_t index = i % this->available_parallelism();
+        STDEXEC_TRACE(enqueue, &tasks[i]);
         queue.queues_[index].push_front(&tasks[i]);
         thread_states_[index]->notify();
       }
@@ -847,6 +858,11 @@ namespace exec {
       __intrusive_queue<&task_base::next> tasks,
       std::size_t tasks_size,
       const nodemask& constraints) noexcept {
+#if STDEXEC_ENABLE_TRACING
+      for (task_base* task: tasks) {
+        STDEXEC_TRACE(enqueue, task);
+      }
+#endif
       static thread_local std::thread::id const this_id = std::this_thread::get_id();
       remote_queue* const correct_queue = this_id == queue.id_ ? &queue : get_remote_queue();
       std::size_t const idx = correct_queue->index_;
@@ -990,6 +1006,7 @@ namespace exec {
         for (std::size_t i = 0; i < pool_->max_steals_; ++i) {
           result = try_steal_near();
           if (result.task) {
+            STDEXEC_TRACE(steal, result.task);
             clear_stealing();
             return result;
           }
@@ -998,6 +1015,7 @@ namespace exec {
         for (std::size_t i = 0; i < pool_->max_steals_; ++i) {
           result = try_steal_any();
           if (result.task) {
+            STDEXEC_TRACE(steal, result.task);
             clear_stealing();
             return result;
           }
@@ -1016,8 +1034,10 @@ namespace exec {
             return result;
           }
           set_sleeping();
+          STDEXEC_TRACE(park, index_);
           cv_.wait(lock);
           lock.unlock();
+          STDEXEC_TRACE(unpark, index_);
           clear_sleeping();
         }
         if (lock.owns_lock()) {
@@ -1379,36 +1399,68 @@ namespace exec {
       template <class Receiver>
       using allocator_of_t = decltype(get_allocator(__declval<Receiver>()));
 
+      //! Returns the number of elements per item for a chunked sequence. A
+      //! requested size of 0 picks one that gives every thread a few chunks.
+      inline auto
+        chunk_size_for(std::size_t size, std::size_t requested, std::size_t nthreads) noexcept
+        -> std::size_t {
+        if (requested != 0) {
+          return requested;
+        }
+        std::size_t num_chunks = nthreads * 4;
+        return (std::max) ((size + num_chunks - 1) / num_chunks, std::size_t{1});
+      }
+
+      //! In a chunked sequence each item is a contiguous sub-range of up to
+      //! `chunk_size_` elements instead of a single element.
       template <class Range>
       struct operation_base {
         Range range_;
         _static_thread_pool& pool_;
+        std::size_t chunk_size_{1};
         std::mutex start_mutex_{};
         bool has_started_{false};
         __intrusive_queue<&task_base::next> tasks_{};
         std::size_t tasks_size_{};
-        __std::atomic<std::size_t> countdown_{std::ranges::size(range_)};
+        std::size_t num_items_{(std::ranges::size(range_) + chunk_size_ - 1) / chunk_size_};
+        __std::atomic<std::size_t> countdown_{num_items_};
       };
 
-      template <class Range, class ItemReceiver>
+      template <class Range, bool Chunked>
+      using item_value_t = __if_c<
+        Chunked,
+        std::ranges::subrange<std::ranges::iterator_t<Range>>,
+        std::ranges::range_reference_t<Range>
+      >;
+
+      template <class Range, class ItemReceiver, bool Chunked>
       class item_operation : task_base {
         static void execute_(task_base* base, std::uint32_t /* tid */) noexcept {
           auto op = static_cast<item_operation*>(base);
-          STDEXEC::set_value(static_cast<ItemReceiver&&>(op->item_receiver_), *op->it_);
+          if constexpr (Chunked) {
+            STDEXEC::set_value(
+              static_cast<ItemReceiver&&>(op->item_receiver_),
+              std::ranges::subrange(op->it_, op->it_ + op->size_));
+          } else {
+            STDEXEC::set_value(static_cast<ItemReceiver&&>(op->item_receiver_), *op->it_);
+          }
         }
 
         ItemReceiver item_receiver_;
         std::ranges::iterator_t<Range> it_;
+        std::ranges::range_difference_t<Range> size_;
         operation_base<Range>* parent_;
 
        public:
         item_operation(
           ItemReceiver&& item_receiver,
           std::ranges::iterator_t<Range> it,
+          std::ranges::range_difference_t<Range> size,
           operation_base<Range>* parent)
           : task_base{.execute_ = execute_}
           , item_receiver_(static_cast<ItemReceiver&&>(item_receiver))
           , it_(it)
+          , size_(size)
           , parent_(parent) {
         }
 
@@ -1424,14 +1476,15 @@ namespace exec {
         }
       };
 
-      template <class Range>
+      template <class Range, bool Chunked>
       struct item_sender {
         using sender_concept = sender_t;
         using completion_signatures =
-          STDEXEC::completion_signatures<set_value_t(std::ranges::range_reference_t<Range>)>;
+          STDEXEC::completion_signatures<set_value_t(item_value_t<Range, Chunked>)>;
 
         operation_base<Range>* op_;
         std::ranges::iterator_t<Range> it_;
+        std::ranges::range_difference_t<Range> size_;
 
         struct attrs {
           _static_thread_pool* pool_;
@@ -1448,8 +1501,9 @@ namespace exec {
 
         template <receiver ItemReceiver>
           requires receiver_of<ItemReceiver, completion_signatures>
-        auto connect(ItemReceiver rcvr) const noexcept -> item_operation<Range, ItemReceiver> {
-          return {static_cast<ItemReceiver&&>(rcvr), it_, op_};
+        auto connect(ItemReceiver rcvr) const noexcept
+          -> item_operation<Range, ItemReceiver, Chunked> {
+          return {static_cast<ItemReceiver&&>(rcvr), it_, size_, op_};
         }
       };
 
@@ -1457,8 +1511,12 @@ namespace exec {
       struct operation_base_with_receiver : operation_base<Range> {
         Receiver rcvr_;
 
-        operation_base_with_receiver(Range range, _static_thread_pool& pool, Receiver rcvr)
-          : operation_base<Range>{range, pool}
+        operation_base_with_receiver(
+          Range range,
+          _static_thread_pool& pool,
+          std::size_t chunk_size,
+          Receiver rcvr)
+          : operation_base<Range>{range, pool, chunk_size}
           , rcvr_(static_cast<Receiver&&>(rcvr)) {
         }
       };
@@ -1488,10 +1546,10 @@ namespace exec {
         operation_base_with_receiver<Range, Receiver>* op_;
       };
 
-      template <class Range, class Receiver>
+      template <class Range, class Receiver, bool Chunked>
       class operation : operation_base_with_receiver<Range, Receiver> {
         using allocator_t = allocator_of_t<const Receiver&>;
-        using item_sender_t = item_sender<Range>;
+        using item_sender_t = item_sender<Range, Chunked>;
         using next_sender_t = next_sender_of_t<Receiver, item_sender_t>;
         using next_receiver_t = next_receiver<Range, Receiver>;
         using item_operation_t = connect_result_t<next_sender_t, next_receiver_t>;
@@ -1502,13 +1560,22 @@ namespace exec {
 
         std::vector<__manual_lifetime<item_operation_t>, item_allocator_t> items_;
 
+        auto item_sender_at(std::size_t i) -> item_sender_t {
+          auto it = std::ranges::begin(this->range_);
+          std::size_t first = i * this->chunk_size_;
+          std::size_t last = (std::min) (first + this->chunk_size_, std::ranges::size(this->range_));
+          using diff_t = std::ranges::range_difference_t<Range>;
+          return {this, it + static_cast<diff_t>(first), static_cast<diff_t>(last - first)};
+        }
+
        public:
-        operation(Range range, _static_thread_pool& pool, Receiver rcvr)
+        operation(Range range, _static_thread_pool& pool, std::size_t chunk_size, Receiver rcvr)
           : operation_base_with_receiver<Range, Receiver>{
               std::move(range),
               pool,
+              chunk_size,
               static_cast<Receiver&&>(rcvr)}
-          , items_(std::ranges::size(this->range_), item_allocator_t(get_allocator(this->rcvr_))) {
+          , items_(this->num_items_, item_allocator_t(get_allocator(this->rcvr_))) {
         }
 
         ~operation() {
@@ -1524,41 +1591,40 @@ namespace exec {
           std::size_t nthreads = this->pool_.available_parallelism();
           bwos_params params = this->pool_.params();
           std::size_t local_size = params.blockSize * params.numBlocks;
-          std::size_t chunk_size = (std::min) (size / nthreads, local_size * nthreads);
+          std::size_t batch_size = (std::max) (
+            (std::min) (size / nthreads, local_size * nthreads), std::size_t{1});
           auto& remote_queue = *this->pool_.get_remote_queue();
-          auto it = std::ranges::begin(this->range_);
           std::size_t i0 = 0;
-          while (i0 + chunk_size < size) {
-            for (std::size_t i = i0; i < i0 + chunk_size; ++i) {
+          while (i0 + batch_size < size) {
+            for (std::size_t i = i0; i < i0 + batch_size; ++i) {
               items_[i].__construct_from(
-                STDEXEC::connect,
-                set_next(this->rcvr_, item_sender_t{this, it + i}),
-                next_receiver_t{this});
+                STDEXEC::connect, set_next(this->rcvr_, item_sender_at(i)), next_receiver_t{this});
               STDEXEC::start(items_[i].__get());
             }
 
             std::unique_lock lock{this->start_mutex_};
-            this->pool_.bulk_enqueue(remote_queue, std::move(this->tasks_), this->tasks_size_);
+            this->pool_.bulk_enqueue(
+              remote_queue, std::move(this->tasks_), std::exchange(this->tasks_size_, 0));
             lock.unlock();
-            i0 += chunk_size;
+            i0 += batch_size;
           }
           for (std::size_t i = i0; i < size; ++i) {
             items_[i].__construct_from(
-              STDEXEC::connect,
-              set_next(this->rcvr_, item_sender_t{this, it + i}),
-              next_receiver_t{this});
+              STDEXEC::connect, set_next(this->rcvr_, item_sender_at(i)), next_receiver_t{this});
             STDEXEC::start(items_[i].__get());
           }
           std::unique_lock lock{this->start_mutex_};
           this->has_started_ = true;
-          this->pool_.bulk_enqueue(remote_queue, std::move(this->tasks_), this->tasks_size_);
+          this->pool_.bulk_enqueue(
+            remote_queue, std::move(this->tasks_), std::exchange(this->tasks_size_, 0));
         }
       };
 
-      template <class Range>
+      template <class Range, bool Chunked>
       class sequence {
         Range range_;
         _static_thread_pool* pool_;
+        std::size_t chunk_size_{1};
 
        public:
         using sender_concept = sequence_sender_t;
@@ -1569,33 +1635,45 @@ namespace exec {
           set_stopped_t()
         >;
 
-        using item_types = exec::item_types<item_sender<Range>>;
+        using item_types = exec::item_types<item_sender<Range, Chunked>>;
 
         sequence(Range range, _static_thread_pool& pool)
+          requires(!Chunked)
           : range_(static_cast<Range&&>(range))
           , pool_(&pool) {
         }
 
+        sequence(Range range, _static_thread_pool& pool, std::size_t chunk_size)
+          requires Chunked
+          : range_(static_cast<Range&&>(range))
+          , pool_(&pool)
+          , chunk_size_(
+              chunk_size_for(std::ranges::size(range_), chunk_size, pool.available_parallelism())) {
+        }
+
         template <exec::sequence_receiver_of<item_types> Receiver>
-        auto subscribe(Receiver rcvr) && noexcept -> operation<Range, Receiver> {
-          return {static_cast<Range&&>(range_), *pool_, static_cast<Receiver&&>(rcvr)};
+        auto subscribe(Receiver rcvr) && noexcept -> operation<Range, Receiver, Chunked> {
+          return {
+            static_cast<Range&&>(range_), *pool_, chunk_size_, static_cast<Receiver&&>(rcvr)};
         }
 
         template <exec::sequence_receiver_of<item_types> Receiver>
           requires __decay_copyable<Range const &>
-        auto subscribe(Receiver rcvr) const & noexcept -> operation<Range, Receiver> {
-          return {range_, *pool_, static_cast<Receiver&&>(rcvr)};
+        auto subscribe(Receiver rcvr) const & noexcept -> operation<Range, Receiver, Chunked> {
+          return {range_, *pool_, chunk_size_, static_cast<Receiver&&>(rcvr)};
         }
       };
     } // namespace schedule_all_
 
     struct schedule_all_t;
+    struct schedule_all_chunked_t;
 #endif
   } // namespace _pool_
 
   struct static_thread_pool : private _pool_::_static_thread_pool {
 #if STDEXEC_HAS_STD_RANGES()
     friend struct _pool_::schedule_all_t;
+    friend struct _pool_::schedule_all_chunked_t;
 #endif
     using task_base = _pool_::task_base;
 
@@ -1639,9 +1717,23 @@ namespace exec {
         return {static_cast<Range&&>(range), pool};
       }
     };
+
+    struct schedule_all_chunked_t {
+      template <class Range>
+      auto operator()(static_thread_pool& pool, Range&& range, std::size_t chunk_size = 0) const
+        -> schedule_all_::sequence<__decay_t<Range>, true> {
+        return {static_cast<Range&&>(range), pool, chunk_size};
+      }
+    };
   } // namespace _pool_
 
   inline constexpr _pool_::schedule_all_t schedule_all{};
+
+  //! Like `schedule_all`, but each item is a `std::ranges::subrange` of up to
+  //! `chunk_size` contiguous elements, so that one task and one completion
+  //! cover a whole chunk. A `chunk_size` of 0 picks a size that gives every
+  //! thread of the pool a few chunks.
+  inline constexpr _pool_::schedule_all_chunked_t schedule_all_chunked{};
 #endif
 
 } // namespace exec
@@ -20,6 +20,7 @@
 
 #include <optional>
 #include <utility>
+#include <vector>
 
 #ifndef STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE
 #  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE 72
@@ -28,7 +29,7 @@
 #  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN 8
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE
-#  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE 152
+#  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE 200
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN
 #  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN 8
@@ -174,16 +175,96 @@ namespace exec {
     - __forward_args_receiver::__arguments_data_ (array of bytes) -- 8 (depending on previous sender)
     - __bulk_state_base::__prepare_storage_for_backend (fun ptr) -- 8
     - __bulk_state_base::__size_ (_Size) -- 4
-    - __bulk_state::__preallocated_ (__preallocated_) -- 152
+    - __bulk_state::__preallocated_ (__preallocated_) -- 200
       - __previous_operation_state_ (__inner_op_state) -- 104
         - __bulk_intermediate_receiver::__state_ (__state_&) -- 8
         - __bulk_intermediate_receiver::__scheduler_ (parallel_scheduler*) -- 8
     ---------------------
-    Total: 176; extra 24 bytes compared to backend needs.
+    Total: 224; extra 24 bytes compared to backend needs.
+
+    The preallocated sizes can be changed by defining the STDEXEC_SYSTEM_CONTEXT_*_OP_SIZE and
+    STDEXEC_SYSTEM_CONTEXT_*_OP_ALIGN macros, e.g. to fit the operations of a replacement backend.
+    Backend operations that do not fit are allocated on the heap.
 
     [*] sizes taken on an Apple M2 Pro arm64 arch. They may differ on other architectures, or with different implementations.
     */
 
+
+    template <class _S, class _Rcvr>
+    struct __system_op;
+  } // namespace detail
+
+  /// While an object of this type is alive, work scheduled on the parallel scheduler from the
+  /// current thread is collected instead of being submitted to the backend one operation at a
+  /// time. The whole batch is submitted with a single `schedule_batch` call when the object is
+  /// destroyed or `flush()` is called. Use it around a burst of submissions, such as starting
+  /// a `when_all` of many parallel senders or a series of `spawn` calls.
+  ///
+  /// Work is not submitted until the batch is flushed. Waiting on the current thread for work
+  /// that is in an unflushed batch therefore deadlocks: call `flush()` before any blocking
+  /// wait within the scope of a batch, such as `sync_wait` or a receiver that blocks until
+  /// another operation of the same batch completes. Batches are per thread, so work started
+  /// on other threads is not held back.
+  /// Out of spec.
+  class parallel_scheduler_batch {
+   public:
+    parallel_scheduler_batch() noexcept
+      : __prev_(std::exchange(__current(), this)) {
+    }
+
+    parallel_scheduler_batch(parallel_scheduler_batch&&) = delete;
+
+    ~parallel_scheduler_batch() {
+      flush();
+      __current() = __prev_;
+    }
+
+    /// Submits the work collected so far to the backend.
+    void flush() noexcept {
+      // Completing the batch may schedule more work on this thread, which is added to a new
+      // batch.
+      while (!__entries_.empty()) {
+        auto __entries = std::exchange(__entries_, {});
+        auto __backend = std::exchange(__backend_, nullptr);
+        __backend->schedule_batch(__entries);
+      }
+    }
+
+   private:
+    template <class, class>
+    friend struct detail::__system_op;
+
+    static auto __current() noexcept -> parallel_scheduler_batch*& {
+      thread_local parallel_scheduler_batch* __batch = nullptr;
+      return __batch;
+    }
+
+    /// Adds `__rcvr` and the preallocated memory of its operation to the batch. Returns false
+    /// if it has to be scheduled separately, because it targets a different backend or because
+    /// memory could not be allocated.
+    auto __try_add(
+      const detail::__backend_ptr& __backend,
+      STDEXEC::system_context_replaceability::receiver_proxy& __rcvr,
+      std::span<std::byte> __storage) noexcept -> bool {
+      if (__backend_ != nullptr && __backend_ != __backend) {
+        return false;
+      }
+      STDEXEC_TRY {
+        __entries_.push_back({&__rcvr, __storage});
+      }
+      STDEXEC_CATCH_ALL {
+        return false;
+      }
+      __backend_ = __backend;
+      return true;
+    }
+
+    parallel_scheduler_batch* __prev_;
+    detail::__backend_ptr __backend_;
+    std::vector<STDEXEC::system_context_replaceability::batch_entry> __entries_;
+  };
+
+  namespace detail {
     /// The operation state used to execute the work described by this sender.
     template <class _S, class _Rcvr>
     struct __system_op {
@@ -213,6 +294,12 @@ namespace exec {
         auto& __scheduler_impl = __preallocated_.__as<__backend_ptr>();
         auto __impl = std::move(__scheduler_impl);
         std::destroy_at(&__scheduler_impl);
+        auto* __batch = parallel_scheduler_batch::__current();
+        if (
+          __batch != nullptr
+          && __batch->__try_add(__impl, __rcvr_, __preallocated_.__as_storage())) {
+          return;
+        }
         __impl->schedule(__rcvr_, __preallocated_.__as_storage());
       }
 
@@ -404,12 +491,29 @@ namespace exec {
         STDEXEC::__type_index __query_type,
         STDEXEC::__type_index __value_type,
         void* __dest) const noexcept override {
+        using __chunk_size_query_t =
+          STDEXEC::system_context_replaceability::get_bulk_chunk_size_t;
         if (__query_type == STDEXEC::__mtypeid<STDEXEC::get_stop_token_t>) {
           __query(STDEXEC::get_stop_token, __value_type, __dest);
+        } else if (__query_type == STDEXEC::__mtypeid<__chunk_size_query_t>) {
+          __query(__chunk_size_query_t(), __value_type, __dest);
         }
       }
 
      private:
+      void __query(
+        STDEXEC::system_context_replaceability::get_bulk_chunk_size_t __query,
+        STDEXEC::__type_index __value_type,
+        void* __dest) const noexcept {
+        auto __state = reinterpret_cast<const _BulkState*>(this);
+        if constexpr (STDEXEC::__callable<decltype(__query), STDEXEC::env_of_t<__rcvr_t>>) {
+          if (__value_type == STDEXEC::__mtypeid<std::size_t>) {
+            *static_cast<std::optional<std::size_t>*>(__dest) = static_cast<std::size_t>(
+              __query(STDEXEC::get_env(__state->__rcvr_)));
+          }
+        }
+      }
+
       void __query(STDEXEC::get_stop_token_t, STDEXEC::__type_index __value_type, void* __dest)
         const noexcept {
         auto __state = reinterpret_cast<const _BulkState*>(this);
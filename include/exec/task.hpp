@@ -25,6 +25,7 @@
 #include "../stdexec/__detail/__variant.hpp"
 #include "../stdexec/execution.hpp"
 
+#include "__detail/__frame_allocator.hpp"
 #include "any_sender_of.hpp"
 #include "at_coroutine_exit.hpp"
 #include "scope.hpp"
@@ -352,9 +353,13 @@ namespace exec {
 
       using __promise_context_t = _Context::template promise_context_t<__promise>;
 
+      // The coroutine frame is allocated with the allocator passed as `std::allocator_arg,
+      // alloc` in the coroutine's parameters, if any, and from a per-thread pool of recycled
+      // frames otherwise.
       struct __promise
         : __promise_base<_Ty>
-        , with_awaitable_senders<__promise> {
+        , with_awaitable_senders<__promise>
+        , __frame::__with_frame_allocator {
 
         constexpr auto get_return_object() noexcept -> basic_task {
           return basic_task(__std::coroutine_handle<__promise>::from_promise(*this));
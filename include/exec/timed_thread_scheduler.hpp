@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "__detail/__trace.hpp"
 #include "__detail/intrusive_heap.hpp"
 #include "timed_scheduler.hpp" // IWYU pragma: keep for schedule_at and schedule_after
 
@@ -111,7 +112,7 @@ namespace exec {
     class timed_thread_schedule_at_op;
   } // namespace _time_thrd_sched
 
-  class timed_thread_context {
+  class STDEXEC_TRACE_ABI_TAG timed_thread_context {
    private:
     static constexpr std::ptrdiff_t context_closed = std::numeric_limits<std::ptrdiff_t>::min() / 2;
    public:
@@ -155,15 +156,18 @@ namespace exec {
         task_type* op = heap_.front();
         while (op && op->time_point_ <= now) {
           heap_.pop_front();
+          STDEXEC_TRACE(dequeue, op);
           op->set_value_(op);
           op = heap_.front();
         }
         time_point deadline = op ? op->time_point_ : now + std::chrono::seconds(2);
         std::unique_lock lock{ready_mutex_};
+        STDEXEC_TRACE(park, 0);
         cv_.wait_until(lock, deadline, [this] { return ready_ || stop_requested_; });
         bool stop_requested = stop_requested_;
         ready_ = false;
         lock.unlock();
+        STDEXEC_TRACE(unpark, 0);
         if (stop_requested) {
           std::ptrdiff_t expected = 0;
           while (!n_submissions_in_flight_.compare_exchange_weak(
@@ -196,6 +200,7 @@ namespace exec {
           .compare_exchange_strong(n, context_closed, STDEXEC::__std::memory_order_relaxed);
         return;
       }
+      STDEXEC_TRACE(enqueue, op);
       if (command_queue_.push_back(op)) {
         std::scoped_lock lock{ready_mutex_};
         ready_ = true;
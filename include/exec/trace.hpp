@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "__detail/__trace.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace exec::trace {
+  // Whether the schedulers were built with tracing enabled.
+  STDEXEC_TRACE_ABI_TAG
+  inline constexpr bool enabled = STDEXEC_ENABLE_TRACING != 0;
+
+  // Writes the events recorded so far as a Chrome trace (load it with
+  // chrome://tracing or https://ui.perfetto.dev). Every event carries the
+  // address of the task or I/O operation it refers to in `args.id`, so the
+  // time a task spent queued is the distance between its `enqueue` and its
+  // `dequeue`. Intervals during which a worker was parked are drawn as
+  // `parked` slices.
+  //
+  // It may be called while traced schedulers are running. Events that are
+  // overwritten while they are being read are left out.
+  STDEXEC_TRACE_ABI_TAG
+  inline void write_chrome_json(std::ostream& __os) {
+    __os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+#if STDEXEC_ENABLE_TRACING
+    struct __event_copy {
+      std::uint64_t __pos_;
+      std::uint64_t __time_ns_;
+      std::uint64_t __arg_;
+      __trace::__event __kind_;
+    };
+    auto& __reg = __trace::__registry::__instance();
+    std::scoped_lock __lock{__reg.__mutex_};
+    std::vector<__event_copy> __events;
+    __events.reserve(STDEXEC_TRACE_BUFFER_SIZE);
+    const char* __sep = "";
+    for (auto& __ring: __reg.__rings_) {
+      std::uint64_t __head = __ring->__head_.load(std::memory_order_acquire);
+      std::uint64_t __first = __head > STDEXEC_TRACE_BUFFER_SIZE
+                              ? __head - STDEXEC_TRACE_BUFFER_SIZE
+                              : 0;
+      __events.clear();
+      for (std::uint64_t __i = __first; __i < __head; ++__i) {
+        const auto& __rec = __ring->__records_[__i % STDEXEC_TRACE_BUFFER_SIZE];
+        __events.push_back(
+          {__i,
+           __rec.__time_ns_.load(std::memory_order_relaxed),
+           __rec.__arg_.load(std::memory_order_relaxed),
+           __rec.__kind_.load(std::memory_order_relaxed)});
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      __head = __ring->__head_.load(std::memory_order_relaxed);
+
+      for (const auto& __rec: __events) {
+        if (!__trace::__ring::__stable(__rec.__pos_, __head)) {
+          continue;
+        }
+        auto __kind = __rec.__kind_;
+        const char* __phase = __kind == __trace::__event::park     ? "B"
+                            : __kind == __trace::__event::unpark ? "E"
+                                                                 : "i";
+        const char* __name = __kind == __trace::__event::park || __kind == __trace::__event::unpark
+                             ? "parked"
+                             : __trace::__event_names[static_cast<int>(__kind)];
+        // Timestamps are in microseconds with nanosecond fractions.
+        __os << __sep << "\n{\"name\":\"" << __name << "\",\"cat\":\"stdexec\",\"ph\":\""
+             << __phase << "\",\"s\":\"t\",\"pid\":1,\"tid\":" << __ring->__tid_
+             << ",\"ts\":" << __rec.__time_ns_ / 1000 << '.' << __rec.__time_ns_ / 100 % 10
+             << __rec.__time_ns_ / 10 % 10 << __rec.__time_ns_ % 10 << ",\"args\":{\"id\":\"0x"
+             << std::hex << __rec.__arg_ << std::dec << "\"}}";
+        __sep = ",";
+      }
+    }
+#endif
+    __os << "\n]}\n";
+  }
+
+  // Discards all recorded events. Must not be called while traced schedulers
+  // are running.
+  STDEXEC_TRACE_ABI_TAG
+  inline void clear() {
+#if STDEXEC_ENABLE_TRACING
+    auto& __reg = __trace::__registry::__instance();
+    std::scoped_lock __lock{__reg.__mutex_};
+    for (auto& __ring: __reg.__rings_) {
+      __ring->__head_.store(0, std::memory_order_relaxed);
+    }
+#endif
+  }
+} // namespace exec::trace
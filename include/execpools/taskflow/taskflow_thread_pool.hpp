@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <taskflow/algorithm/for_each.hpp>
 #include <taskflow/taskflow.hpp>
 
 #include <execpools/thread_pool_base.hpp>
@@ -41,6 +42,40 @@ namespace execpools {
       executor_.silent_async([task, tid] { task->execute_(task, /*tid=*/tid); });
     }
 
+    //! Splits the shape into a few chunks per worker and lets Taskflow's guided partitioner
+    //! balance them. Called from a worker, so the taskflow is co-run rather than waited on.
+    template <class Shape, class Fun>
+    void bulk_execute(Shape shape, Fun&& fun) {
+      constexpr std::size_t chunks_per_worker = 8;
+      const auto num_chunks = static_cast<Shape>(
+        (std::min) (static_cast<std::size_t>(shape), available_parallelism() * chunks_per_worker));
+      std::exception_ptr eptr;
+      std::atomic_flag failed{};
+
+      tf::Taskflow taskflow;
+      taskflow.for_each_index(
+        Shape{0},
+        num_chunks,
+        Shape{1},
+        [&](Shape chunk) {
+          auto [begin, end] = exec::_pool_::even_share(shape, chunk, num_chunks);
+          STDEXEC_TRY {
+            fun(begin, end);
+          }
+          STDEXEC_CATCH_ALL {
+            if (!failed.test_and_set()) {
+              eptr = std::current_exception();
+            }
+          }
+        },
+        tf::GuidedPartitioner());
+      executor_.corun(taskflow);
+
+      if (eptr) {
+        std::rethrow_exception(eptr);
+      }
+    }
+
     tf::Executor executor_;
   };
 } // namespace execpools
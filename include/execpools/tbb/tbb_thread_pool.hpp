@@ -17,6 +17,9 @@
  */
 #pragma once
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
 #include <tbb/task_arena.h>
 
 #include <exec/static_thread_pool.hpp>
@@ -53,6 +56,16 @@ namespace execpools {
       arena_.enqueue([task, tid] { task->execute_(task, /*tid=*/tid); });
     }
 
+    //! Called from a task in the arena, so the range is split and stolen by the arena's
+    //! threads.
+    template <class Shape, class Fun>
+    void bulk_execute(Shape shape, Fun&& fun) {
+      tbb::parallel_for(
+        tbb::blocked_range<Shape>(Shape{0}, shape),
+        [&](const tbb::blocked_range<Shape>& range) { fun(range.begin(), range.end()); },
+        tbb::auto_partitioner{});
+    }
+
     tbb::task_arena arena_{tbb::task_arena::attach{}};
   };
 } // namespace execpools
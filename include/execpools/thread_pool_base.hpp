@@ -31,6 +31,12 @@ namespace execpools {
   //! and
   //! * template<F> auto execute(F &&f) -> decltype(f())
   //!
+  //! A pool with its own parallel loop can also provide
+  //! * template<Shape, F> void bulk_execute(Shape shape, F &&f)
+  //! which is called from a task running on the pool, and must call `f(begin, end)` for
+  //! subranges that cover [0, shape) before returning. `bulk_chunked` then hands the whole
+  //! shape to it, instead of splitting it evenly over one task per agent. Unless it is
+  //! `noexcept`, an exception that escapes it is sent as an error.
   template <class PoolType, class Receiver>
   struct operation;
 
@@ -120,8 +126,10 @@ namespace execpools {
 
       template <class Fun, class Shape, class... Args>
       using bulk_non_throwing = STDEXEC::__mbool<
-        // If function invocation doesn't throw
-        STDEXEC::__nothrow_callable<Fun, Shape, Args...> &&
+        // If the pool's own parallel loop doesn't throw
+        !thread_pool_base::__bulk_execute_may_throw() &&
+        // and function invocation, with the bounds of a chunk, doesn't throw
+        STDEXEC::__nothrow_callable<Fun, Shape, Shape, Args...> &&
         // and emplacing a tuple doesn't throw
         noexcept(STDEXEC::__decayed_std_tuple<Args...>(std::declval<Args>()...))
         // there's no need to advertise completion with `exception_ptr`
@@ -148,6 +156,10 @@ namespace execpools {
 
         [[nodiscard]]
         auto num_agents_required() const -> std::uint32_t {
+          // A pool with its own parallel loop balances the load itself, from a single task.
+          if constexpr (thread_pool_base::__has_bulk_execute()) {
+            return 1;
+          }
           // With work stealing, is std::min necessary, or can we feel free to ask for more agents (tasks)
           // than we can actually deal with at one time?
           return static_cast<std::uint32_t>(
@@ -174,8 +186,13 @@ namespace execpools {
             auto total_threads = self.num_agents_required();
 
             auto computation = [&](auto&... args) {
-              auto [begin, end] = exec::_pool_::even_share(self.shape_, tid, total_threads);
-              self.fun_(begin, end, args...);
+              if constexpr (thread_pool_base::__has_bulk_execute()) {
+                self.pool_.bulk_execute(
+                  self.shape_, [&](Shape begin, Shape end) { self.fun_(begin, end, args...); });
+              } else {
+                auto [begin, end] = exec::_pool_::even_share(self.shape_, tid, total_threads);
+                self.fun_(begin, end, args...);
+              }
             };
 
             auto completion = [&](auto&... args) {
@@ -441,6 +458,26 @@ namespace execpools {
     }
 
    private:
+    //! Whether the derived pool provides `bulk_execute`. Checked here, where its private
+    //! members are accessible, and only once the derived pool is complete.
+    static consteval auto __has_bulk_execute() noexcept -> bool {
+      return requires(
+        DerivedPoolType& pool, std::uint32_t shape, void (*fun)(std::uint32_t, std::uint32_t)) {
+        pool.bulk_execute(shape, fun);
+      };
+    }
+
+    //! Whether the `bulk_execute` of the derived pool may throw, e.g. because it allocates.
+    static consteval auto __bulk_execute_may_throw() noexcept -> bool {
+      return __has_bulk_execute()
+          && !requires(
+               DerivedPoolType& pool,
+               std::uint32_t shape,
+               void (*fun)(std::uint32_t, std::uint32_t)) {
+               { pool.bulk_execute(shape, fun) } noexcept;
+             };
+    }
+
     void enqueue(task_base* task, std::uint32_t tid = 0) noexcept {
       static_cast<DerivedPoolType&>(*this).enqueue(task, tid);
     }
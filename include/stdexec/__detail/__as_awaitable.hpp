@@ -17,11 +17,14 @@
 
 #include "__execution_fwd.hpp"
 
+#include "__atomic.hpp"
 #include "__awaitable.hpp"
+#include "__completion_behavior.hpp"
 #include "__completion_signatures_of.hpp"
 #include "__concepts.hpp"
 #include "__connect.hpp"
 #include "__meta.hpp"
+#include "__sender_concepts.hpp"
 #include "__tag_invoke.hpp"
 #include "__type_traits.hpp"
 
@@ -55,12 +58,26 @@ namespace STDEXEC {
   namespace __as_awaitable {
     struct __void { };
 
+    struct __stopped { };
+
     template <class _Value>
     using __value_or_void_t = __if_c<__same_as<_Value, void>, __void, _Value>;
 
     template <class _Value>
     using __expected_t =
-      std::variant<std::monostate, __value_or_void_t<_Value>, std::exception_ptr>;
+      std::variant<std::monostate, __value_or_void_t<_Value>, std::exception_ptr, __stopped>;
+
+    // A sender whose completions are all known to happen inline, within `start()`, can be
+    // started from `await_ready`. The awaiting coroutine then only suspends if the sender
+    // completes with set_stopped.
+    template <class _Tag, class _Sender, class _Env>
+    concept __completes_inline_or_never =
+      __never_sends<_Tag, _Sender, _Env> || __completes_inline<_Tag, env_of_t<_Sender>, _Env>;
+
+    template <class _Sender, class _Env>
+    concept __inline_sender = __completes_inline_or_never<set_value_t, _Sender, _Env>
+                           && __completes_inline_or_never<set_error_t, _Sender, _Env>
+                           && __completes_inline_or_never<set_stopped_t, _Sender, _Env>;
 
     // Helper to cast a coroutine_handle<void> to coroutine_handle<_Promise>
     template <class _Promise>
@@ -78,11 +95,11 @@ namespace STDEXEC {
       void set_value(_Us&&... __us) noexcept {
         STDEXEC_TRY {
           __result_->template emplace<1>(static_cast<_Us&&>(__us)...);
-          __continuation_.resume();
         }
         STDEXEC_CATCH_ALL {
-          STDEXEC::set_error(static_cast<__receiver_base&&>(*this), std::current_exception());
+          __result_->template emplace<2>(std::current_exception());
         }
+        __complete();
       }
 
       template <class _Error>
@@ -93,21 +110,40 @@ namespace STDEXEC {
           __result_->template emplace<2>(std::make_exception_ptr(std::system_error(__err)));
         else
           __result_->template emplace<2>(std::make_exception_ptr(static_cast<_Error&&>(__err)));
-        __continuation_.resume();
+        __complete();
+      }
+
+      // The receiver and `await_suspend` race to set the ready flag. Whichever comes second
+      // resumes the coroutine: the receiver if the operation completed asynchronously, and
+      // `await_suspend` (by symmetric transfer) if it completed inline. A null flag means
+      // that the operation was started from `await_ready` and always completes inline.
+      [[nodiscard]]
+      auto __completed_second() const noexcept -> bool {
+        return __ready_ != nullptr && __ready_->exchange(true, __std::memory_order_acq_rel);
+      }
+
+      void __complete() noexcept {
+        if (__completed_second()) {
+          __continuation_.resume();
+        }
       }
 
       __expected_t<_Value>* __result_;
+      __std::atomic<bool>* __ready_;
       __std::coroutine_handle<> __continuation_;
     };
 
     template <class _Promise, class _Value>
     struct __receiver : __receiver_base<_Value> {
       constexpr void set_stopped() noexcept {
-        auto __continuation = __coroutine_handle_cast<_Promise>(this->__continuation_);
-        // Do not use type deduction here so that we perform any conversions necessary on
-        // the stopped continuation:
-        __std::coroutine_handle<> __on_stopped = __continuation.promise().unhandled_stopped();
-        __on_stopped.resume();
+        this->__result_->template emplace<3>();
+        if (this->__completed_second()) {
+          auto __continuation = __coroutine_handle_cast<_Promise>(this->__continuation_);
+          // Do not use type deduction here so that we perform any conversions necessary on
+          // the stopped continuation:
+          __std::coroutine_handle<> __on_stopped = __continuation.promise().unhandled_stopped();
+          __on_stopped.resume();
+        }
       }
 
       // Forward get_env query to the coroutine promise
@@ -122,11 +158,6 @@ namespace STDEXEC {
 
     template <class _Value>
     struct __sender_awaitable_base {
-      [[nodiscard]]
-      constexpr auto await_ready() const noexcept -> bool {
-        return false;
-      }
-
       constexpr auto await_resume() -> _Value {
         switch (__result_.index()) {
         case 0: // receiver contract not satisfied
@@ -139,12 +170,15 @@ namespace STDEXEC {
             return;
         case 2: // set_error
           std::rethrow_exception(std::get<2>(__result_));
+        default: // set_stopped resumes the coroutine's unhandled_stopped continuation instead
+          break;
         }
         std::terminate();
       }
 
      protected:
       __expected_t<_Value> __result_;
+      __std::atomic<bool> __ready_{false};
     };
 
     template <class _Promise, class _Sender>
@@ -154,15 +188,40 @@ namespace STDEXEC {
         : __op_state_(connect(
             static_cast<_Sender&&>(sndr),
             __receiver{
-              {&this->__result_, __hcoro}
+              {&this->__result_, __is_inline ? nullptr : &this->__ready_, __hcoro}
       })) {
       }
 
-      constexpr void await_suspend(__std::coroutine_handle<_Promise>) noexcept {
-        STDEXEC::start(__op_state_);
+      [[nodiscard]]
+      constexpr auto await_ready() noexcept -> bool {
+        if constexpr (__is_inline) {
+          STDEXEC::start(__op_state_);
+          return this->__result_.index() != 3;
+        } else {
+          return false;
+        }
+      }
+
+      constexpr auto await_suspend(__std::coroutine_handle<_Promise> __hcoro) noexcept
+        -> __std::coroutine_handle<> {
+        if constexpr (__is_inline) {
+          // The operation completed with set_stopped from within await_ready.
+          return __hcoro.promise().unhandled_stopped();
+        } else {
+          STDEXEC::start(__op_state_);
+          if (!this->__ready_.exchange(true, __std::memory_order_acq_rel)) {
+            // The operation has not completed yet. The receiver will resume the coroutine.
+            return __std::noop_coroutine();
+          }
+          if (this->__result_.index() == 3) {
+            return __hcoro.promise().unhandled_stopped();
+          }
+          return __hcoro;
+        }
       }
 
      private:
+      static constexpr bool __is_inline = __inline_sender<_Sender, env_of_t<_Promise&>>;
       using __receiver = __receiver_t<_Sender, _Promise>;
       connect_result_t<_Sender, __receiver> __op_state_;
     };
@@ -54,6 +54,11 @@ namespace STDEXEC {
       return true;
     }
 
+    STDEXEC_ATTRIBUTE(nodiscard, host, device)
+    constexpr auto empty() const noexcept -> bool {
+      return __head_.load(__std::memory_order_relaxed) == nullptr;
+    }
+
     STDEXEC_ATTRIBUTE(host, device)
     constexpr void wait_for_item() noexcept {
       // Wait until the queue has an item in it:
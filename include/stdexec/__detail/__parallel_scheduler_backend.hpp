@@ -24,8 +24,10 @@
 #include "../functional.hpp" // IWYU pragma: keep for __with_default
 #include "../stop_token.hpp"
 #include "__queries.hpp"
+#include "__query.hpp"
 #include "__typeinfo.hpp"
 
+#include <cstddef>
 #include <exception>
 #include <optional>
 #include <span>
@@ -102,6 +104,31 @@ namespace STDEXEC {
       virtual void execute(size_t, size_t) noexcept = 0;
     };
 
+    /// A query for the number of iterations that the parallel scheduler backend passes to each
+    /// `execute` call of a chunked bulk operation. Receivers of bulk operations can answer it to
+    /// override the backend's chunk sizing, e.g. with `prop{get_bulk_chunk_size, 1024}`.
+    /// Backends read it with `try_query<size_t>(get_bulk_chunk_size)`.
+    /// NOT TO SPEC.
+    struct get_bulk_chunk_size_t : __query<get_bulk_chunk_size_t> {
+      using __query<get_bulk_chunk_size_t>::operator();
+
+      STDEXEC_ATTRIBUTE(nodiscard, always_inline, host, device)
+      static consteval auto query(forwarding_query_t) noexcept -> bool {
+        return true;
+      }
+    };
+
+    inline constexpr get_bulk_chunk_size_t get_bulk_chunk_size{};
+
+    /// An operation of a batch passed to `parallel_scheduler_backend::schedule_batch`: the
+    /// receiver to complete, and the preallocated memory of the operation, as `schedule` gets
+    /// them.
+    /// NOT TO SPEC.
+    struct batch_entry {
+      receiver_proxy* receiver;
+      std::span<std::byte> storage;
+    };
+
     /// Interface for the parallel scheduler backend.
     struct parallel_scheduler_backend {
       virtual ~parallel_scheduler_backend() = 0;
@@ -121,6 +148,17 @@ namespace STDEXEC {
         size_t,
         bulk_item_receiver_proxy&,
         std::span<std::byte>) noexcept = 0;
+
+      /// Schedule work on parallel scheduler for each entry in `__batch`, as if by calling
+      /// `schedule` with its receiver and preallocated memory. The span only needs to remain
+      /// valid for the duration of the call; the memory of each entry, until its receiver is
+      /// completed. Backends can override this to submit the whole batch at once.
+      /// NOT TO SPEC.
+      virtual void schedule_batch(std::span<batch_entry> __batch) noexcept {
+        for (batch_entry& __entry: __batch) {
+          schedule(*__entry.receiver, __entry.storage);
+        }
+      }
     };
 
     inline parallel_scheduler_backend::~parallel_scheduler_backend() = default;
@@ -153,6 +191,8 @@ namespace STDEXEC {
           __query(get_stop_token, __value, __dest);
         } else if (__query_id == __mtypeid<get_allocator_t>) {
           __query(get_allocator, __value, __dest);
+        } else if (__query_id == __mtypeid<system_context_replaceability::get_bulk_chunk_size_t>) {
+          __query(system_context_replaceability::get_bulk_chunk_size, __value, __dest);
         }
       }
 
@@ -167,6 +207,20 @@ namespace STDEXEC {
         }
       }
 
+      void __query(
+        system_context_replaceability::get_bulk_chunk_size_t,
+        __type_index __value_type,
+        void* __dest) const noexcept {
+        using __query_t = system_context_replaceability::get_bulk_chunk_size_t;
+        if constexpr (__callable<__query_t, env_of_t<_Rcvr>>) {
+          if (__value_type == __mtypeid<std::size_t>) {
+            using __dest_t = std::optional<std::size_t>;
+            *static_cast<__dest_t*>(__dest) = static_cast<std::size_t>(
+              system_context_replaceability::get_bulk_chunk_size(STDEXEC::get_env(__rcvr_)));
+          }
+        }
+      }
+
       void __query(get_allocator_t, __type_index __value_type, void* __dest) const noexcept {
         if (__value_type == __mtypeid<any_allocator<std::byte>>) {
           using __dest_t = std::optional<any_allocator<std::byte>>;
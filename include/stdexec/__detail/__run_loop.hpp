@@ -25,9 +25,12 @@
 #include "__env.hpp"
 #include "__receivers.hpp"
 #include "__schedulers.hpp"
+#include "__spin_loop_pause.hpp"
 #include "__stop_token.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <utility>
 
 namespace STDEXEC {
   /////////////////////////////////////////////////////////////////////////////
@@ -40,11 +43,14 @@ namespace STDEXEC {
       STDEXEC_ASSERT(__task_count_.load(__std::memory_order_acquire) == 0);
     }
 
+    // The functions that execute work (run, run_one, poll, run_for and run_until) must all
+    // be called from the same thread, or at least not concurrently.
+
     STDEXEC_ATTRIBUTE(host, device)
     void run() noexcept {
       // execute work items until the __finishing_ flag is set:
       while (!__finishing_.load(__std::memory_order_acquire)) {
-        __queue_.wait_for_item();
+        __wait_for_task();
         __execute_all();
       }
       // drain the queue, taking care to execute any tasks that get added while
@@ -53,6 +59,70 @@ namespace STDEXEC {
         ;
     }
 
+    // Blocks until a task is ready or finish() has been called, and executes at most one
+    // task. Returns the number of tasks executed.
+    STDEXEC_ATTRIBUTE(host, device)
+    auto run_one() noexcept -> std::size_t {
+      while (true) {
+        if (__ready_.empty()) {
+          __ready_ = __queue_.pop_all();
+        }
+        if (!__ready_.empty()) {
+          __task* __next = __ready_.pop_front();
+          const bool __is_noop = __next == &__noop_task;
+          __next->__execute();
+          __task_count_.fetch_sub(1, __std::memory_order_release);
+          if (!__is_noop) {
+            return 1;
+          }
+        } else if (__finishing_.load(__std::memory_order_acquire)) {
+          return 0;
+        } else {
+          __wait_for_task();
+        }
+      }
+    }
+
+    // Executes the tasks that are ready without blocking. Returns the number of tasks
+    // executed.
+    STDEXEC_ATTRIBUTE(host, device)
+    auto poll() noexcept -> std::size_t {
+      return __execute_all();
+    }
+
+    // Executes tasks as they become ready until the deadline passes, or until finish() has
+    // been called and there is no more work. This polls the queue instead of blocking on it,
+    // so that the loop can be driven from an external busy-polling loop without paying for
+    // futex wake-ups. Returns the number of tasks executed.
+    template <class _Clock, class _Duration>
+    auto run_until(const std::chrono::time_point<_Clock, _Duration>& __deadline) -> std::size_t {
+      std::size_t __count = 0;
+      do {
+        if (const std::size_t __executed = __execute_all()) {
+          __count += __executed;
+        } else if (
+          __finishing_.load(__std::memory_order_acquire)
+          && __task_count_.load(__std::memory_order_acquire) == 0) {
+          break;
+        } else {
+          __spin_loop_pause();
+        }
+      } while (_Clock::now() < __deadline);
+      return __count;
+    }
+
+    template <class _Rep, class _Period>
+    auto run_for(const std::chrono::duration<_Rep, _Period>& __duration) -> std::size_t {
+      return run_until(std::chrono::steady_clock::now() + __duration);
+    }
+
+    // Sets how many times run() and run_one() poll an empty queue before blocking on it.
+    // Spinning trades CPU time for lower wake-up latency when work arrives in bursts.
+    STDEXEC_ATTRIBUTE(host, device)
+    void set_spin_count(std::size_t __spin_count) noexcept {
+      __spin_count_ = __spin_count;
+    }
+
     STDEXEC_ATTRIBUTE(host, device)
     void finish() noexcept {
       // Increment our task count to avoid lifetime issues. This is preventing
@@ -131,31 +201,47 @@ namespace STDEXEC {
       }
     };
 
-    // Returns true if any tasks were executed.
     STDEXEC_ATTRIBUTE(host, device)
-    constexpr bool __execute_all() noexcept {
-      // Dequeue all tasks at once. This returns an __intrusive_queue.
-      auto __queue = __queue_.pop_all();
+    void __wait_for_task() noexcept {
+      // Tasks that run_one has dequeued but not executed yet are ready.
+      if (!__ready_.empty()) {
+        return;
+      }
+      for (std::size_t __i = 0; __i < __spin_count_ && __queue_.empty(); ++__i) {
+        STDEXEC_IF_HOST(__spin_loop_pause());
+      }
+      __queue_.wait_for_item();
+    }
+
+    // Returns the number of tasks executed, not counting the wake-up task pushed by finish().
+    STDEXEC_ATTRIBUTE(host, device)
+    constexpr auto __execute_all() noexcept -> std::size_t {
+      // Dequeue all tasks at once, after any left over by run_one. This returns an
+      // __intrusive_queue.
+      auto __queue = std::exchange(__ready_, {});
+      __queue.append(__queue_.pop_all());
 
       // Execute all the tasks in the queue.
       auto __it = __queue.begin();
       if (__it == __queue.end()) {
-        return false; // No tasks to execute.
+        return 0; // No tasks to execute.
       }
 
       std::size_t __task_count = 0;
+      bool __saw_noop = false;
 
       do {
         // Take care to increment the iterator before executing the task,
         // because __execute() may invalidate the current node.
         auto __prev = __it++;
+        __saw_noop |= *__prev == &__noop_task;
         (*__prev)->__execute();
         ++__task_count;
       } while (__it != __queue.end());
 
       __queue.clear();
       __task_count_.fetch_sub(__task_count, __std::memory_order_release);
-      return true;
+      return __task_count - static_cast<std::size_t>(__saw_noop);
     }
 
     STDEXEC_ATTRIBUTE(host, device) static constexpr void __noop_(__task*) noexcept {
@@ -164,6 +250,8 @@ namespace STDEXEC {
     __std::atomic<std::size_t> __task_count_{0};
     __std::atomic<bool> __finishing_{false};
     __atomic_intrusive_queue<&__task::__next_> __queue_{};
+    __intrusive_queue<&__task::__next_> __ready_{}; // only accessed by the consumer thread
+    std::size_t __spin_count_{0};
     __task __noop_task{&__noop_};
   };
 
@@ -22,18 +22,18 @@
 #include "__atomic.hpp"
 #include "__basic_sender.hpp"
 #include "__env.hpp"
-#include "__intrusive_slist.hpp"
 #include "__memory.hpp"
 #include "__meta.hpp"
 #include "__optional.hpp"
 #include "__queries.hpp"
 #include "__receivers.hpp"
+#include "__spin_loop_pause.hpp"
 #include "__transform_completion_signatures.hpp"
 #include "__tuple.hpp"
 #include "__variant.hpp" // IWYU pragma: keep
 
+#include <cstdint>
 #include <exception>
-#include <mutex>
 #include <utility>
 
 ////////////////////////////////////////////////////////////////////////////
@@ -137,10 +137,193 @@ namespace STDEXEC::__shared {
   ////////////////////////////////////////////////////////////////////////////////////////
   struct __local_state_base : __immovable {
     __local_state_base() = default;
-    constexpr virtual void __notify() noexcept {
-      // should never be called
+    constexpr virtual void __notify() noexcept = 0;
+
+    // start publishes the waiter on the waiter stack between __begin_publish and
+    // __end_publish. Neither the stop callback nor the completion touch the waiter in the
+    // meantime, so once __end_publish returns, start does not touch anything again.
+    enum __publish_state : unsigned char {
+      __unpublished,
+      __publishing,
+      __published,
+      __stopped_early
+    };
+
+    /// @return false if the stop callback ran before the waiter could be published.
+    [[nodiscard]]
+    auto __begin_publish() noexcept -> bool {
+      unsigned char __expected = __unpublished;
+      return __publish_.compare_exchange_strong(
+        __expected, __publishing, __std::memory_order_acq_rel, __std::memory_order_acquire);
+    }
+
+    void __end_publish() noexcept {
+      __publish_.store(__published, __std::memory_order_release);
     }
+
+    /// @brief Called by the stop callback.
+    /// @return true if the waiter has been published, in which case the caller takes it off
+    /// the waiter stack. Otherwise, start sees the stop request and completes the waiter.
+    [[nodiscard]]
+    auto __stop_requested_after_publish() noexcept -> bool {
+      auto __state = __publish_.load(__std::memory_order_acquire);
+      for (;;) {
+        if (__state == __publishing) {
+          __spin_loop_pause();
+          __state = __publish_.load(__std::memory_order_acquire);
+        } else if (__state != __unpublished) {
+          return true;
+        } else if (__publish_.compare_exchange_weak(
+                     __state,
+                     __stopped_early,
+                     __std::memory_order_acq_rel,
+                     __std::memory_order_acquire)) {
+          return false;
+        }
+      }
+    }
+
+    /// @brief Called before the completion notifies the waiter.
+    void __wait_until_published() const noexcept {
+      while (__publish_.load(__std::memory_order_acquire) == __publishing) {
+        __spin_loop_pause();
+      }
+    }
+
     __local_state_base* __next_ = nullptr;
+    __std::atomic<unsigned char> __publish_{__unpublished};
+  };
+
+  ////////////////////////////////////////////////////////////////////////////////////////
+  // A lock-free intrusive stack of the operation states waiting on a shared operation.
+  //
+  // Waiters are pushed with a CAS on the head pointer. When the shared operation completes,
+  // the whole stack is drained by exchanging the head with a "tombstone" value, after which
+  // pushes fail and the caller notifies the waiter directly.
+  //
+  // Removing a waiter in response to a stop request is the only operation that needs
+  // exclusion. The remover sets the low bit of the head pointer, which keeps other removers
+  // and the drain out while it unlinks the node. Pushes are not blocked: they only ever
+  // replace the head, and they preserve the bit when they do so.
+  class __waiter_stack : __immovable {
+    static_assert(alignof(__local_state_base) > 1);
+    static constexpr std::uintptr_t __removing_bit = 1;
+
+    [[nodiscard]]
+    static auto __to_addr(__local_state_base* __node) noexcept -> std::uintptr_t {
+      return reinterpret_cast<std::uintptr_t>(__node);
+    }
+
+    [[nodiscard]]
+    static auto __to_node(std::uintptr_t __addr) noexcept -> __local_state_base* {
+      return reinterpret_cast<__local_state_base*>(__addr & ~__removing_bit);
+    }
+
+    [[nodiscard]]
+    auto __tombstone() const noexcept -> std::uintptr_t {
+      // The address of the stack itself is never the address of a waiter.
+      return reinterpret_cast<std::uintptr_t>(this);
+    }
+
+   public:
+    __waiter_stack() = default;
+
+    [[nodiscard]]
+    auto __is_completed() const noexcept -> bool {
+      return __head_.load(__std::memory_order_acquire) == __tombstone();
+    }
+
+    /// @brief Push a waiter onto the stack.
+    /// @return false if the stack has already been drained.
+    [[nodiscard]]
+    auto __push(__local_state_base* __node) noexcept -> bool {
+      auto __old = __head_.load(__std::memory_order_acquire);
+      do {
+        if (__old == __tombstone()) {
+          return false;
+        }
+        __node->__next_ = __to_node(__old);
+      } while (!__head_.compare_exchange_weak(
+        __old,
+        __to_addr(__node) | (__old & __removing_bit),
+        __std::memory_order_acq_rel,
+        __std::memory_order_acquire));
+      return true;
+    }
+
+    /// @brief Remove a waiter from the stack.
+    /// @return false if the waiter was not found, either because it was never pushed, it
+    /// was already removed, or the stack has been drained.
+    [[nodiscard]]
+    auto __remove(__local_state_base* __node) noexcept -> bool {
+      // Acquire the "removing" bit.
+      auto __old = __head_.load(__std::memory_order_acquire);
+      for (;;) {
+        if (__old == __tombstone()) {
+          return false;
+        } else if (__old & __removing_bit) {
+          __spin_loop_pause();
+          __old = __head_.load(__std::memory_order_acquire);
+        } else if (__head_.compare_exchange_weak(
+                     __old,
+                     __old | __removing_bit,
+                     __std::memory_order_acq_rel,
+                     __std::memory_order_acquire)) {
+          __old |= __removing_bit;
+          break;
+        }
+      }
+
+      bool __found = false;
+      for (;;) {
+        __local_state_base* __head = __to_node(__old);
+        if (__head == __node) {
+          // The node is at the head. A concurrent push may move it down the stack, in which
+          // case we try again.
+          __found = __head_.compare_exchange_strong(
+            __old,
+            __to_addr(__node->__next_) | __removing_bit,
+            __std::memory_order_acq_rel,
+            __std::memory_order_acquire);
+          if (!__found) {
+            continue;
+          }
+        } else {
+          // The interior links of the stack are only modified while holding the bit.
+          for (auto* __prev = __head; __prev != nullptr; __prev = __prev->__next_) {
+            if (__prev->__next_ == __node) {
+              __prev->__next_ = __node->__next_;
+              __found = true;
+              break;
+            }
+          }
+        }
+        break;
+      }
+
+      __head_.fetch_and(~__removing_bit, __std::memory_order_release);
+      return __found;
+    }
+
+    /// @brief Take all the waiters off the stack, leaving the tombstone behind.
+    /// @post Subsequent calls to __push and __remove fail.
+    [[nodiscard]]
+    auto __drain() noexcept -> __local_state_base* {
+      auto __old = __head_.load(__std::memory_order_acquire);
+      for (;;) {
+        STDEXEC_ASSERT(__old != __tombstone());
+        if (__old & __removing_bit) {
+          __spin_loop_pause();
+          __old = __head_.load(__std::memory_order_acquire);
+        } else if (__head_.compare_exchange_weak(
+                     __old, __tombstone(), __std::memory_order_acq_rel, __std::memory_order_acquire)) {
+          return __to_node(__old);
+        }
+      }
+    }
+
+   private:
+    __std::atomic<std::uintptr_t> __head_{0};
   };
 
   ////////////////////////////////////////////////////////////////////////////////////////
@@ -203,17 +386,17 @@ namespace STDEXEC::__shared {
     constexpr void operator()() noexcept {
       // We reach here when a split/ensure_started sender has received a stop request from the
       // receiver to which it is connected.
-      if (std::unique_lock __lock{__sh_state_->__mutex_}) {
-        // Remove this operation from the waiters list. Removal can fail if:
-        //   1. It was already removed by another thread, or
-        //   2. It hasn't been added yet (see `start` below), or
-        //   3. The underlying operation has already completed.
-
-        // In each case, the right thing to do is nothing. If (1) then we raced with another
-        // thread and lost. In that case, the other thread will take care of it. If (2) then
-        // `start` will take care of it. If (3) then this stop request is safe to ignore.
-        if (!__sh_state_->__waiters_.remove(this))
-          return;
+      //
+      // Remove this operation from the waiters list. Removal can fail if:
+      //   1. It was already removed by another thread, or
+      //   2. It hasn't been added yet (see `start` below), or
+      //   3. The underlying operation has already completed.
+      //
+      // In each case, the right thing to do is nothing. If (1) then we raced with another
+      // thread and lost. In that case, the other thread will take care of it. If (2) then
+      // `start` will take care of it. If (3) then this stop request is safe to ignore.
+      if (!__stop_requested_after_publish() || !__sh_state_->__waiters_.__remove(this)) {
+        return;
       }
 
       // The following code and the __notify function cannot both execute. This is because the
@@ -248,9 +431,7 @@ namespace STDEXEC::__shared {
   ////////////////////////////////////////////////////////////////////////////////////////
   //! Base class for heap-allocatable shared state for `split` and `ensure_started`.
   template <class _Env, class _Variant>
-  struct __shared_state_base : __local_state_base {
-    using __waiters_list_t = __intrusive_slist<&__local_state_base::__next_>;
-
+  struct __shared_state_base {
     constexpr explicit __shared_state_base(_Env __env)
       : __env_(
           __env::__join(
@@ -282,23 +463,16 @@ namespace STDEXEC::__shared {
     /// @brief This is called when the shared async operation completes.
     /// @post __waiters_ is set to a known "tombstone" value.
     void __notify_waiters() noexcept {
-      __waiters_list_t __waiters_copy{this};
-
       // Set the waiters list to a known "tombstone" value that we can check later.
-      {
-        std::lock_guard __lock{this->__mutex_};
-        this->__waiters_.swap(__waiters_copy);
-      }
+      __local_state_base* __item = this->__waiters_.__drain();
 
-      STDEXEC_ASSERT(__waiters_copy.front() != this);
-      for (auto __itr = __waiters_copy.begin(); __itr != __waiters_copy.end();) {
-        __local_state_base* __item = *__itr;
-
-        // We must increment the iterator before calling notify, since notify may end up
-        // triggering *__item to be destructed on another thread, and the intrusive slist's
-        // iterator increment relies on __item.
-        ++__itr;
+      while (__item != nullptr) {
+        __item->__wait_until_published();
+        // We must read the next pointer before calling notify, since notify may end up
+        // triggering *__item to be destructed on another thread.
+        __local_state_base* __next = std::exchange(__item->__next_, nullptr);
         __item->__notify();
+        __item = __next;
       }
 
       // Set the "is running" bit in the ref count to zero. Delete the shared state if the
@@ -308,8 +482,7 @@ namespace STDEXEC::__shared {
 
     constexpr virtual void __set_completed() noexcept = 0;
 
-    std::mutex __mutex_{}; // This mutex guards access to __waiters_.
-    __waiters_list_t __waiters_{};
+    __waiter_stack __waiters_{};
     inplace_stop_source __stop_source_{};
     __env_t<_Env> __env_;
     _Variant __results_{}; // Initialized to the "set_stopped" state in the ctor.
@@ -325,7 +498,6 @@ namespace STDEXEC::__shared {
     : std::enable_shared_from_this<__shared_state<_CvSender, _Env>>
     , __shared_state_base<_Env, __result_variant_t<_CvSender, _Env>> {
     using __receiver_t = __receiver<_Env, __result_variant_t<_CvSender, _Env>>;
-    using __waiters_list_t = __shared_state::__shared_state_base::__waiters_list_t;
 
     constexpr explicit __shared_state(_CvSender&& __sndr, _Env __env)
       : __shared_state::__shared_state_base(static_cast<_Env&&>(__env))
@@ -368,20 +540,23 @@ namespace STDEXEC::__shared {
 
     template <class _StopToken>
     auto __try_add_waiter(__local_state_base* __waiter, _StopToken __stok) noexcept -> bool {
-      std::unique_lock __lock{this->__mutex_};
-      if (this->__waiters_.front() == this) {
+      if (this->__waiters_.__is_completed()) {
         // The work has already completed. Notify the waiter immediately.
-        __lock.unlock();
         __waiter->__notify();
         return true;
-      } else if (__stok.stop_requested()) {
+      } else if (__stok.stop_requested() || !__waiter->__begin_publish()) {
         // Stop has been requested. Do not add the waiter.
         return false;
-      } else {
-        // Add the waiter to the list.
-        this->__waiters_.push_front(__waiter);
+      } else if (!this->__waiters_.__push(__waiter)) {
+        // The work completed while we were trying to add the waiter.
+        __waiter->__end_publish();
+        __waiter->__notify();
         return true;
       }
+      // From now on, the stop callback or the completion of the work completes the waiter,
+      // which may destroy it and release the shared state. Touch nothing after this.
+      __waiter->__end_publish();
+      return true;
     }
 
     constexpr void __detach() noexcept {
@@ -15,13 +15,19 @@
  */
 #pragma once
 
+#include "../../exec/__detail/__frame_allocator.hpp"
 #include "__atomic.hpp"
 #include "__system_context_replaceability_api.hpp"
 
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <vector>
+
 #if STDEXEC_ENABLE_LIBDISPATCH
 #  include "../../exec/libdispatch_queue.hpp" // IWYU pragma: keep
-#elif STDEXEC_ENABLE_IO_URING
-#  include "../../exec/linux/io_uring_context.hpp" // IWYU pragma: keep
+#elif STDEXEC_ENABLE_IO_URING && STDEXEC_SYSTEM_CONTEXT_USE_IO_URING
+#  include "../../exec/linux/io_uring_parallel_scheduler_backend.hpp" // IWYU pragma: keep
 #elif STDEXEC_ENABLE_WINDOWS_THREAD_POOL
 #  include "../../exec/windows/windows_thread_pool.hpp" // IWYU pragma: keep
 #else
@@ -31,8 +37,11 @@
 namespace STDEXEC::__system_context_default_impl {
   using system_context_replaceability::__parallel_scheduler_backend_factory;
 
+  /// The state of an operation that needs none besides its inner operation state.
+  struct __no_state { };
+
   /// Receiver that calls the callback when the operation completes.
-  template <class _Sender>
+  template <class _Sender, class _State = __no_state>
   struct __operation;
 
   /*
@@ -54,13 +63,18 @@ namespace STDEXEC::__system_context_default_impl {
   - __bulk_unchunked_functor::__r_ (bulk_item_receiver*) - 8
   ---------------------
   Total: 152; extra 24 bytes compared to internal operation state.
+  For bulk_chunked, __operation::__state_ (__bulk_chunked_state) takes 48 more bytes, for a total
+  of 200.
+
+  Operations that do not fit in the preallocated storage are allocated with
+  __recycling_allocator.
 
   Using libdispatch backend, the operation sizes are 48 (down from 80) and 128 (down from 160).
 
   [*] sizes taken on an Apple M2 Pro arm64 arch. They may differ on other architectures, or with different implementations.
   */
 
-  template <class _Sender>
+  template <class _Sender, class _State = __no_state>
   struct __recv {
     using receiver_concept = STDEXEC::receiver_t;
 
@@ -68,7 +82,7 @@ namespace STDEXEC::__system_context_default_impl {
     STDEXEC::system_context_replaceability::receiver_proxy* __r_;
 
     //! The parent operation state that we will destroy when we complete.
-    __operation<_Sender>* __op_;
+    __operation<_Sender, _State>* __op_;
 
     void set_value() noexcept {
       auto __op = __op_;
@@ -118,10 +132,51 @@ namespace STDEXEC::__system_context_default_impl {
     }
   }
 
-  template <typename _Sender>
+  /// Allocates from the calling thread's pool of recycled blocks. Operation states that do not
+  /// fit in the frontend's preallocated storage are allocated with it, so that work scheduled
+  /// from the pool's own threads reuses the memory of operations that completed there instead
+  /// of going through the global heap every time.
+  template <class _Ty>
+  struct __recycling_allocator {
+    using value_type = _Ty;
+
+    __recycling_allocator() = default;
+
+    template <class _Other>
+    __recycling_allocator(const __recycling_allocator<_Other>&) noexcept {
+    }
+
+    [[nodiscard]]
+    auto allocate(size_t __n) -> _Ty* {
+      if constexpr (alignof(_Ty) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return std::allocator<_Ty>().allocate(__n);
+      } else {
+        // Rounded up to the bucket size even during thread exit, when the pool is gone,
+        // because the thread that frees the block may cache it in its own pool.
+        return static_cast<_Ty*>(exec::__frame::__frame_pool::__allocate_block(__n * sizeof(_Ty)));
+      }
+    }
+
+    void deallocate(_Ty* __ptr, size_t __n) noexcept {
+      if constexpr (alignof(_Ty) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        std::allocator<_Ty>().deallocate(__ptr, __n);
+      } else {
+        exec::__frame::__frame_pool::__deallocate_block(__ptr, __n * sizeof(_Ty));
+      }
+    }
+
+    template <class _Other>
+    auto operator==(const __recycling_allocator<_Other>&) const noexcept -> bool {
+      return true;
+    }
+  };
+
+  template <typename _Sender, class _State>
   struct __operation {
+    /// State that the sender refers to, and that lives as long as the operation.
+    STDEXEC_ATTRIBUTE(no_unique_address) _State __state_;
     /// The inner operation state, that results out of connecting the underlying sender with the receiver.
-    STDEXEC::connect_result_t<_Sender, __recv<_Sender>> __inner_op_;
+    STDEXEC::connect_result_t<_Sender, __recv<_Sender, _State>> __inner_op_;
     /// True if the operation is on the heap, false if it is in the preallocated space.
     bool __on_heap_;
 
@@ -130,11 +185,35 @@ namespace STDEXEC::__system_context_default_impl {
       std::span<std::byte> __storage,
       STDEXEC::system_context_replaceability::receiver_proxy* __completion,
       _Sender __sndr) -> __operation* {
+      return __construct_maybe_alloc(
+        __storage, __completion, [&__sndr](_State*) noexcept -> _Sender&& {
+          return std::move(__sndr);
+        });
+    }
+
+    /// Like the above, but constructs the state from `__state_args` first, and connects the
+    /// sender produced by `__make_sender(&__state_)`.
+    template <class _MakeSender, class... _StateArgs>
+    static auto __construct_maybe_alloc(
+      std::span<std::byte> __storage,
+      STDEXEC::system_context_replaceability::receiver_proxy* __completion,
+      _MakeSender __make_sender,
+      _StateArgs&&... __state_args) -> __operation* {
       __storage = __ensure_alignment(__storage, alignof(__operation));
       if (__storage.data() == nullptr || __storage.size() < sizeof(__operation)) {
-        return new __operation(std::move(__sndr), __completion, true);
+        __recycling_allocator<__operation> __alloc;
+        __operation* __op = __alloc.allocate(1);
+        STDEXEC_TRY {
+          return ::new (static_cast<void*>(__op)) __operation(
+            __make_sender, __completion, true, static_cast<_StateArgs&&>(__state_args)...);
+        }
+        STDEXEC_CATCH_ALL {
+          __alloc.deallocate(__op, 1);
+          STDEXEC_THROW();
+        }
       } else {
-        return new (__storage.data()) __operation(std::move(__sndr), __completion, false);
+        return new (__storage.data()) __operation(
+          __make_sender, __completion, false, static_cast<_StateArgs&&>(__state_args)...);
       }
     }
 
@@ -146,22 +225,121 @@ namespace STDEXEC::__system_context_default_impl {
     /// Destructs the operation; frees any allocated memory.
     void __destruct() {
       if (__on_heap_) {
-        delete this;
+        std::destroy_at(this);
+        __recycling_allocator<__operation>().deallocate(this, 1);
       } else {
         std::destroy_at(this);
       }
     }
 
    private:
+    template <class _MakeSender, class... _StateArgs>
     __operation(
-      _Sender __sndr,
+      _MakeSender& __make_sender,
       STDEXEC::system_context_replaceability::receiver_proxy* __completion,
-      bool __on_heap)
-      : __inner_op_(STDEXEC::connect(std::move(__sndr), __recv<_Sender>{__completion, this}))
+      bool __on_heap,
+      _StateArgs&&... __state_args)
+      : __state_(static_cast<_StateArgs&&>(__state_args)...)
+      , __inner_op_(STDEXEC::connect(
+          __make_sender(&__state_),
+          __recv<_Sender, _State>{__completion, this}))
       , __on_heap_(__on_heap) {
     }
   };
 
+  template <class _Sender>
+  struct __batch_operation;
+
+  /// Receiver for the bulk operation that runs a batch of `schedule` requests. Each bulk item
+  /// completes one of the frontend receivers; if the bulk operation fails, the receivers that
+  /// were not completed yet get the error.
+  template <class _Sender>
+  struct __batch_recv {
+    using receiver_concept = STDEXEC::receiver_t;
+
+    __batch_operation<_Sender>* __op_;
+
+    void set_value() noexcept {
+      delete __op_;
+    }
+
+    void set_error(std::exception_ptr __ptr) noexcept {
+      for (auto* __rcvr: __release()) {
+        if (__rcvr != nullptr) {
+          __rcvr->set_error(std::exception_ptr(__ptr));
+        }
+      }
+    }
+
+    void set_stopped() noexcept {
+      for (auto* __rcvr: __release()) {
+        if (__rcvr != nullptr) {
+          __rcvr->set_stopped();
+        }
+      }
+    }
+
+   private:
+    auto __release() noexcept
+      -> std::vector<STDEXEC::system_context_replaceability::receiver_proxy*> {
+      auto __rcvrs = std::move(__op_->__rcvrs_);
+      delete __op_;
+      return __rcvrs;
+    }
+  };
+
+  template <class _Sender>
+  struct __batch_operation {
+    using __rcvrs_t = std::vector<STDEXEC::system_context_replaceability::receiver_proxy*>;
+
+    /// Copies the receivers of `__batch` and connects the sender produced by
+    /// `__make_sender(data, size)`.
+    template <class _MakeSender>
+    __batch_operation(
+      std::span<STDEXEC::system_context_replaceability::batch_entry> __batch,
+      _MakeSender __make_sender)
+      : __rcvrs_(__receivers_of(__batch))
+      , __inner_op_(STDEXEC::connect(
+          __make_sender(__rcvrs_.data(), __rcvrs_.size()),
+          __batch_recv<_Sender>{this})) {
+    }
+
+    static auto
+      __receivers_of(std::span<STDEXEC::system_context_replaceability::batch_entry> __batch)
+        -> __rcvrs_t {
+      __rcvrs_t __rcvrs;
+      __rcvrs.reserve(__batch.size());
+      for (auto& __entry: __batch) {
+        __rcvrs.push_back(__entry.receiver);
+      }
+      return __rcvrs;
+    }
+
+    /// The receivers of the batch; bulk items null out the entries they complete.
+    __rcvrs_t __rcvrs_;
+    STDEXEC::connect_result_t<_Sender, __batch_recv<_Sender>> __inner_op_;
+  };
+
+  //! The time that a chunk of a `bulk_chunked` operation should take: long enough to amortize
+  //! the cost of claiming and dispatching it, short enough to keep the workers balanced.
+  inline constexpr std::chrono::nanoseconds __target_bulk_chunk_time{20'000};
+
+  //! The size of the next chunk of a `bulk_chunked` operation, after a chunk of __chunk_size
+  //! iterations took __elapsed: twice as large if it was much faster than the target, half as
+  //! large if it was much slower, and at least 1 and at most __max_chunk_size.
+  [[nodiscard]]
+  constexpr auto __next_bulk_chunk_size(
+    size_t __chunk_size,
+    size_t __max_chunk_size,
+    std::chrono::nanoseconds __elapsed) noexcept -> size_t {
+    if (__elapsed < __target_bulk_chunk_time / 2) {
+      return (std::min) (__chunk_size * 2, __max_chunk_size);
+    } else if (__elapsed > __target_bulk_chunk_time * 2) {
+      return (std::max) (__chunk_size / 2, size_t{1});
+    }
+    return __chunk_size;
+  }
+
   template <typename _T>
   concept __has_available_paralellism = requires(_T __pool) {
     { __pool.available_parallelism() } -> std::integral;
@@ -189,29 +367,64 @@ namespace STDEXEC::__system_context_default_impl {
     //! Use a value of 0 to disable chunking.
     size_t __available_parallelism_{};
 
-    //! Helper class that maps from a chunk index to the start and end of the chunk.
-    struct __chunker {
-      size_t __chunk_size_;
-      size_t __max_size_;
-
-      [[nodiscard]]
-      size_t __begin(size_t __chunk_index) const noexcept {
-        return __chunk_index * __chunk_size_;
+    //! The shared state of a `bulk_chunked` operation. Each worker repeatedly claims the next
+    //! chunk of iterations from a shared counter and sends an `execute` signal for it to the
+    //! frontend. Unless the frontend fixes the chunk size, workers time the chunks they execute
+    //! and adjust the chunk size with `__next_bulk_chunk_size`, starting from a single iteration,
+    //! until a chunk takes about `__target_bulk_chunk_time`.
+    class __bulk_chunked_state {
+     public:
+      __bulk_chunked_state(
+        STDEXEC::system_context_replaceability::bulk_item_receiver_proxy* __r,
+        size_t __size,
+        size_t __chunk_size,
+        size_t __max_chunk_size,
+        bool __fixed) noexcept
+        : __r_(__r)
+        , __size_(__size)
+        , __max_chunk_size_(__max_chunk_size)
+        , __fixed_(__fixed)
+        , __chunk_size_(__chunk_size) {
       }
 
-      [[nodiscard]]
-      size_t __end(size_t __chunk_index) const noexcept {
-        return (std::min) (__begin(__chunk_index + 1), __max_size_);
+      void __run() noexcept {
+        while (true) {
+          const size_t __chunk_size = __chunk_size_.load(STDEXEC::__std::memory_order_relaxed);
+          const size_t __begin =
+            __next_.fetch_add(__chunk_size, STDEXEC::__std::memory_order_relaxed);
+          if (__begin >= __size_) {
+            return;
+          }
+          const size_t __end = (std::min) (__begin + __chunk_size, __size_);
+          if (__fixed_) {
+            __r_->execute(__begin, __end);
+            continue;
+          }
+          const auto __start = std::chrono::steady_clock::now();
+          __r_->execute(__begin, __end);
+          const auto __elapsed = std::chrono::steady_clock::now() - __start;
+          __chunk_size_.store(
+            __next_bulk_chunk_size(__chunk_size, __max_chunk_size_, __elapsed),
+            STDEXEC::__std::memory_order_relaxed);
+        }
       }
+
+     private:
+      STDEXEC::system_context_replaceability::bulk_item_receiver_proxy* __r_;
+      size_t __size_;
+      size_t __max_chunk_size_;
+      bool __fixed_;
+      STDEXEC::__std::atomic<size_t> __next_{0};
+      STDEXEC::__std::atomic<size_t> __chunk_size_;
     };
 
-    //! Functor called by the `bulk_chunked` operation; sends a `execute` signal to the frontend.
+    //! Functor called by the `bulk_chunked` operation, once per worker. The state lives in the
+    //! operation.
     struct __bulk_chunked_functor {
-      STDEXEC::system_context_replaceability::bulk_item_receiver_proxy* __r_;
-      __chunker __chunker_;
+      __bulk_chunked_state* __state_;
 
-      void operator()(size_t const __idx) const noexcept {
-        __r_->execute(__chunker_.__begin(__idx), __chunker_.__end(__idx));
+      void operator()(size_t) const noexcept {
+        __state_->__run();
       }
     };
 
@@ -224,20 +437,38 @@ namespace STDEXEC::__system_context_default_impl {
       }
     };
 
+    //! Functor called by the `schedule_batch` operation; completes one of the frontend receivers.
+    struct __batch_functor {
+      STDEXEC::system_context_replaceability::receiver_proxy** __rcvrs_;
+
+      void operator()(size_t const __idx) const noexcept {
+        std::exchange(__rcvrs_[__idx], nullptr)->set_value();
+      }
+    };
+
     using __schedule_operation_t =
       __operation<decltype(STDEXEC::schedule(std::declval<__pool_scheduler_t>()))>;
 
-    using __schedule_bulk_chunked_operation_t = __operation<decltype(STDEXEC::bulk(
+    using __schedule_bulk_chunked_operation_t = __operation<
+      decltype(STDEXEC::bulk(
+        STDEXEC::schedule(std::declval<__pool_scheduler_t>()),
+        STDEXEC::par,
+        std::declval<size_t>(),
+        std::declval<__bulk_chunked_functor>())),
+      __bulk_chunked_state
+    >;
+
+    using __schedule_bulk_unchunked_operation_t = __operation<decltype(STDEXEC::bulk(
       STDEXEC::schedule(std::declval<__pool_scheduler_t>()),
       STDEXEC::par,
       std::declval<size_t>(),
-      std::declval<__bulk_chunked_functor>()))>;
+      std::declval<__bulk_unchunked_functor>()))>;
 
-    using __schedule_bulk_unchunked_operation_t = __operation<decltype(STDEXEC::bulk(
+    using __batch_sender_t = decltype(STDEXEC::bulk(
       STDEXEC::schedule(std::declval<__pool_scheduler_t>()),
       STDEXEC::par,
       std::declval<size_t>(),
-      std::declval<__bulk_unchunked_functor>()))>;
+      std::declval<__batch_functor>()));
 
    public:
     void schedule(
@@ -259,23 +490,31 @@ namespace STDEXEC::__system_context_default_impl {
       STDEXEC::system_context_replaceability::bulk_item_receiver_proxy& __rcvr,
       std::span<std::byte> __storage) noexcept override {
       STDEXEC_TRY {
-        // Determine the chunking size based on the ratio between the given size and the number of workers in our pool.
-        // Aim at having 2 chunks per worker.
-        size_t __chunk_size = (__available_parallelism_ > 0
-                               && __size > 3ul * __available_parallelism_)
-                              ? __size / __available_parallelism_ / 2ul
-                              : 1ul;
-        size_t __num_chunks = (__size + __chunk_size - 1) / __chunk_size;
-
-        auto __sndr = STDEXEC::bulk(
-          STDEXEC::schedule(__pool_scheduler_),
-          STDEXEC::par,
-          __num_chunks,
-          __bulk_chunked_functor{
-            &__rcvr, __chunker{__chunk_size, __size}
-        });
+        const size_t __workers = (std::max) (__available_parallelism_, size_t{1});
+        // Keep at least 4 chunks per worker so that the load can be balanced.
+        const size_t __max_chunk_size = (std::max) (__size / (__workers * 4), size_t{1});
+        const std::optional<size_t> __fixed_chunk_size = __rcvr.try_query<size_t>(
+          STDEXEC::system_context_replaceability::get_bulk_chunk_size);
+        const size_t __chunk_size =
+          __fixed_chunk_size ? (std::max) (*__fixed_chunk_size, size_t{1}) : 1ul;
+        const size_t __num_chunks = (__size + __chunk_size - 1) / __chunk_size;
+
+        auto __make_sender = [&](__bulk_chunked_state* __state) {
+          return STDEXEC::bulk(
+            STDEXEC::schedule(__pool_scheduler_),
+            STDEXEC::par,
+            (std::min) (__workers, __num_chunks),
+            __bulk_chunked_functor{__state});
+        };
         auto __os = __schedule_bulk_chunked_operation_t::__construct_maybe_alloc(
-          __storage, &__rcvr, std::move(__sndr));
+          __storage,
+          &__rcvr,
+          __make_sender,
+          &__rcvr,
+          __size,
+          __chunk_size,
+          __max_chunk_size,
+          __fixed_chunk_size.has_value());
         __os->start();
       }
       STDEXEC_CATCH_ALL {
@@ -301,6 +540,32 @@ namespace STDEXEC::__system_context_default_impl {
         __rcvr.set_error(std::current_exception());
       }
     }
+
+    //! Submits the whole batch to the pool as a single bulk operation, with one item per
+    //! receiver.
+    void schedule_batch(
+      std::span<STDEXEC::system_context_replaceability::batch_entry> __batch) noexcept override {
+      if (__batch.empty()) {
+        return;
+      }
+      STDEXEC_TRY {
+        auto* __os = new __batch_operation<__batch_sender_t>(
+          __batch,
+          [this](STDEXEC::system_context_replaceability::receiver_proxy** __data, size_t __size) {
+            return STDEXEC::bulk(
+              STDEXEC::schedule(__pool_scheduler_),
+              STDEXEC::par,
+              __size,
+              __batch_functor{__data});
+          });
+        STDEXEC::start(__os->__inner_op_);
+      }
+      STDEXEC_CATCH_ALL {
+        for (auto& __entry: __batch) {
+          __entry.receiver->set_error(std::current_exception());
+        }
+      }
+    }
   };
 
   /// Keeps track of the backends for the system context interfaces.
@@ -371,8 +636,11 @@ namespace STDEXEC::__system_context_default_impl {
 
 #if STDEXEC_ENABLE_LIBDISPATCH
   using __parallel_scheduler_backend_impl = __generic_impl<exec::libdispatch_queue>;
-#elif STDEXEC_ENABLE_IO_URING
-  using __parallel_scheduler_backend_impl = __generic_impl<exec::io_uring_context>;
+#elif STDEXEC_ENABLE_IO_URING && STDEXEC_SYSTEM_CONTEXT_USE_IO_URING
+  // Opt-in: the workers of this backend block in io_uring_enter while they are idle, so it
+  // only pays off for programs that also issue I/O through its io_scheduler(). Other
+  // io_uring builds keep the static_thread_pool default below.
+  using __parallel_scheduler_backend_impl = exec::io_uring_parallel_scheduler_backend;
 #elif STDEXEC_ENABLE_WINDOWS_THREAD_POOL
   using __parallel_scheduler_backend_impl = __generic_impl<exec::windows_thread_pool>;
 #else
@@ -120,7 +120,10 @@ namespace STDEXEC {
   struct __priority<0> { };
 
   inline constexpr auto __umin(std::initializer_list<std::size_t> __il) noexcept -> std::size_t {
-    std::size_t __m = 0;
+    if (__il.size() == 0) {
+      return 0;
+    }
+    std::size_t __m = *__il.begin();
     for (std::size_t __i: __il) {
       if (__i < __m) {
         __m = __i;
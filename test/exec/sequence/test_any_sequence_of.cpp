@@ -18,8 +18,15 @@
 
 #include "exec/sequence/any_sequence_of.hpp"
 #include "exec/sequence/empty_sequence.hpp"
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
 
 #include <catch2/catch.hpp>
+#include <test_common/allocators.hpp>
+
+#include <algorithm>
+#include <array>
 
 STDEXEC_PRAGMA_PUSH()
 STDEXEC_PRAGMA_IGNORE_GNU("-Wunused-function")
@@ -145,6 +152,172 @@ namespace {
       >);
   }
 
+#if STDEXEC_HAS_STD_RANGES()
+  TEST_CASE(
+    "any_sequence_of - basic_any_sender streams items through inline buffers",
+    "[sequence_senders][any_sequence_of]") {
+    using Completions = STDEXEC::completion_signatures<
+      STDEXEC::set_value_t(int),
+      STDEXEC::set_error_t(std::exception_ptr),
+      STDEXEC::set_stopped_t()
+    >;
+    using receiver_ref = exec::any_sequence_receiver_ref<Completions>;
+    using sequence_t = receiver_ref::basic_any_sender<256, 512>;
+    STATIC_REQUIRE(exec::sequence_sender<sequence_t>);
+    STATIC_REQUIRE(sizeof(sequence_t) > 256);
+
+    int sum = 0;
+    sequence_t any_sequence = exec::iterate(std::views::iota(0, 100));
+    auto result = STDEXEC::sync_wait(exec::ignore_all_values(
+      std::move(any_sequence)
+      | exec::transform_each(STDEXEC::then([&sum](int value) { sum += value; }))));
+    CHECK(result.has_value());
+    CHECK(sum == 4950);
+  }
+
+  // Records the largest number of live allocations of the sequence receiver's
+  // allocator that is seen while an item completes.
+  template <class Receiver>
+  struct allocation_recording_item_rcvr {
+    using receiver_concept = STDEXEC::receiver_t;
+    Receiver rcvr;
+    const int* count;
+    int* max_count;
+
+    [[nodiscard]]
+    auto get_env() const noexcept -> STDEXEC::env_of_t<Receiver> {
+      return STDEXEC::get_env(rcvr);
+    }
+
+    template <class... As>
+    void set_value(As&&...) noexcept {
+      *max_count = (std::max) (*max_count, *count);
+      STDEXEC::set_value(static_cast<Receiver&&>(rcvr));
+    }
+
+    void set_stopped() noexcept {
+      STDEXEC::set_value(static_cast<Receiver&&>(rcvr));
+    }
+
+    template <class E>
+    void set_error(E&&) noexcept {
+      STDEXEC::set_value(static_cast<Receiver&&>(rcvr));
+    }
+  };
+
+  template <class Item>
+  struct allocation_recording_sender {
+    using sender_concept = STDEXEC::sender_t;
+    using completion_signatures = STDEXEC::completion_signatures<STDEXEC::set_value_t()>;
+
+    Item item_;
+    const int* count_;
+    int* max_count_;
+
+    template <
+      STDEXEC::__decays_to<allocation_recording_sender> Self,
+      STDEXEC::receiver_of<completion_signatures> Receiver
+    >
+    STDEXEC_EXPLICIT_THIS_BEGIN(auto connect)(this Self&& self, Receiver rcvr) noexcept {
+      return STDEXEC::connect(
+        static_cast<Self&&>(self).item_,
+        allocation_recording_item_rcvr<Receiver>{
+          static_cast<Receiver&&>(rcvr), self.count_, self.max_count_});
+    }
+    STDEXEC_EXPLICIT_THIS_END(connect)
+  };
+
+  struct allocation_recording_receiver {
+    using receiver_concept = STDEXEC::receiver_t;
+
+    template <class Item>
+    auto set_next(Item&& item) noexcept
+      -> allocation_recording_sender<STDEXEC::__decay_t<Item>> {
+      return {static_cast<Item&&>(item), count_, max_count_};
+    }
+
+    void set_value() noexcept {
+      *done_ = true;
+    }
+
+    void set_stopped() noexcept {
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+    }
+
+    [[nodiscard]]
+    auto get_env() const noexcept {
+      return STDEXEC::prop{STDEXEC::get_allocator, counting_allocator<std::byte>{count_}};
+    }
+
+    int* count_;
+    int* max_count_;
+    bool* done_;
+  };
+
+  TEST_CASE(
+    "any_sequence_of - basic_any_sender does not allocate per item after subscribe",
+    "[sequence_senders][any_sequence_of]") {
+    using Completions = STDEXEC::completion_signatures<
+      STDEXEC::set_value_t(int),
+      STDEXEC::set_error_t(std::exception_ptr),
+      STDEXEC::set_stopped_t()
+    >;
+    // Forwarding the allocator lets the erased operation states of the items
+    // allocate with it, where the test can see them.
+    using receiver_ref = exec::any_sequence_receiver_ref<
+      Completions,
+      STDEXEC::get_allocator.signature<counting_allocator<std::byte>() noexcept>
+    >;
+    using sequence_t = receiver_ref::basic_any_sender<256, 512>;
+
+    int count = 0;
+    int max_count = 0;
+    bool done = false;
+    sequence_t any_sequence = exec::iterate(std::views::iota(0, 1000));
+    {
+      auto op = exec::subscribe(
+        std::move(any_sequence), allocation_recording_receiver{&count, &max_count, &done});
+      const int after_subscribe = count;
+      STDEXEC::start(op);
+      CHECK(done);
+      CHECK(max_count == after_subscribe);
+    }
+    CHECK(count == 0);
+
+    // With buffers too small for the items, the same check sees the allocations.
+    using small_sequence_t = receiver_ref::basic_any_sender<16, 16>;
+    small_sequence_t small_sequence = exec::iterate(std::views::iota(0, 10));
+    max_count = 0;
+    {
+      auto op = exec::subscribe(
+        std::move(small_sequence), allocation_recording_receiver{&count, &max_count, &done});
+      const int after_subscribe = count;
+      STDEXEC::start(op);
+      CHECK(max_count > after_subscribe);
+    }
+    CHECK(count == 0);
+  }
+#endif // STDEXEC_HAS_STD_RANGES()
+
+  TEST_CASE(
+    "any_sequence_of - basic_any_sender passes items larger than its buffers",
+    "[sequence_senders][any_sequence_of]") {
+    using Completions = STDEXEC::completion_signatures<STDEXEC::set_value_t(std::array<int, 64>)>;
+    using sequence_t = exec::any_sequence_receiver_ref<Completions>::basic_any_sender<16, 16>;
+    std::array<int, 64> big{};
+    big[0] = 42;
+    int value = 0;
+    sequence_t any_sequence = STDEXEC::just(big);
+    auto result = STDEXEC::sync_wait(exec::ignore_all_values(
+      std::move(any_sequence)
+      | exec::transform_each(
+        STDEXEC::then([&value](const std::array<int, 64>& a) { value = a[0]; }))));
+    CHECK(result.has_value());
+    CHECK(value == 42);
+  }
+
 } // namespace
 
 STDEXEC_PRAGMA_POP()
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdexec/coroutine.hpp>
+
+#if !STDEXEC_NO_STD_COROUTINES()
+#  include "exec/sequence/async_generator.hpp"
+
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
+#  include "exec/static_thread_pool.hpp"
+
+#  include <catch2/catch.hpp>
+
+#  include <atomic>
+#  include <stdexcept>
+#  include <string>
+#  include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+  auto count_to(int n) -> exec::async_generator<int> {
+    for (int i = 0; i < n; ++i) {
+      co_yield i;
+    }
+  }
+
+  TEST_CASE(
+    "async_generator - emits every yielded value in order",
+    "[sequence_senders][async_generator]") {
+    STATIC_REQUIRE(exec::sequence_sender<exec::async_generator<int>>);
+
+    auto words = []() -> exec::async_generator<std::string> {
+      std::string first = "lvalue";
+      co_yield first;
+      co_yield std::string("rvalue");
+      co_yield co_await ex::just(std::string("awaited"));
+    };
+
+    std::vector<std::string> received;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      words() | exec::transform_each(ex::then([&](std::string s) {
+        received.push_back(std::move(s));
+      }))));
+    CHECK(result.has_value());
+    CHECK(received == std::vector<std::string>{"lvalue", "rvalue", "awaited"});
+  }
+
+  TEST_CASE(
+    "async_generator - a synchronous consumer does not grow the stack",
+    "[sequence_senders][async_generator]") {
+    long sum = 0;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      count_to(1'000'000) | exec::transform_each(ex::then([&](int i) { sum += i; }))));
+    CHECK(result.has_value());
+    CHECK(sum == 999'999L * 1'000'000 / 2);
+  }
+
+  TEST_CASE(
+    "async_generator - waits for each item to be consumed",
+    "[sequence_senders][async_generator]") {
+    exec::static_thread_pool pool{2};
+    std::atomic<int> produced{0};
+    std::atomic<int> consumed{0};
+    bool overtaken = false;
+
+    auto produce = [&]() -> exec::async_generator<int> {
+      for (int i = 0; i < 200; ++i) {
+        overtaken |= produced != consumed;
+        ++produced;
+        co_yield i;
+      }
+    };
+
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      produce()
+      | exec::transform_each(
+        ex::continues_on(pool.get_scheduler()) | ex::then([&](int) { ++consumed; }))));
+    CHECK(result.has_value());
+    CHECK(consumed == 200);
+    CHECK_FALSE(overtaken);
+  }
+
+  TEST_CASE(
+    "async_generator - sends an escaping exception as an error",
+    "[sequence_senders][async_generator]") {
+    auto failing = []() -> exec::async_generator<int> {
+      co_yield 1;
+      throw std::runtime_error("async_generator");
+    };
+
+    int count = 0;
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(
+        failing() | exec::transform_each(ex::then([&](int) { ++count; })))),
+      std::runtime_error);
+    CHECK(count == 1);
+  }
+
+  TEST_CASE(
+    "async_generator - a stopped co_await stops the sequence",
+    "[sequence_senders][async_generator]") {
+    auto stopping = []() -> exec::async_generator<int> {
+      co_yield 1;
+      co_await ex::just_stopped();
+      co_yield 2;
+    };
+
+    std::vector<int> received;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      stopping() | exec::transform_each(ex::then([&](int i) { received.push_back(i); }))));
+    CHECK_FALSE(result.has_value());
+    CHECK(received == std::vector{1});
+  }
+
+  TEST_CASE(
+    "async_generator - is destroyed at its co_yield when the consumer stops",
+    "[sequence_senders][async_generator]") {
+    struct guard {
+      ~guard() {
+        *destroyed_ = true;
+      }
+
+      bool* destroyed_;
+    };
+
+    bool destroyed = false;
+    int yielded = 0;
+    auto produce = [&]() -> exec::async_generator<int> {
+      guard g{&destroyed};
+      for (int i = 0;; ++i) {
+        ++yielded;
+        co_yield i;
+      }
+    };
+
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(produce() | exec::transform_each(ex::then([](int i) {
+                                              if (i == 3) {
+                                                throw std::runtime_error("enough");
+                                              }
+                                            })))),
+      std::runtime_error);
+    CHECK(yielded == 4);
+    CHECK(destroyed);
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/batch.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <test_common/type_helpers.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+  using namespace std::chrono_literals;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  struct collect_batches {
+    auto operator()(std::vector<int> batch) const {
+      std::scoped_lock lock{*mutex_};
+      batches_->push_back(std::move(batch));
+    }
+
+    std::mutex* mutex_;
+    std::vector<std::vector<int>>* batches_;
+  };
+
+  TEST_CASE("batch - groups items by size", "[sequence_senders][batch]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> batches;
+    auto batched = exec::iterate(std::views::iota(0, 10)) | exec::batch(sched, 4, 10s);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(batched)>);
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      batched | exec::transform_each(ex::then(collect_batches{&mutex, &batches}))));
+    CHECK(result.has_value());
+    // The remainder is flushed when the input completes, without waiting
+    // for the timeout.
+    CHECK(std::chrono::steady_clock::now() - start < 5s);
+    REQUIRE(batches.size() == 3);
+    CHECK(batches[0] == std::vector{0, 1, 2, 3});
+    CHECK(batches[1] == std::vector{4, 5, 6, 7});
+    CHECK(batches[2] == std::vector{8, 9});
+  }
+
+  TEST_CASE(
+    "batch - flushes a partial batch when the timeout expires",
+    "[sequence_senders][batch]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    // Every item takes longer than the timeout, so each batch holds one value.
+    auto slow = ex::let_value([sched](int i) {
+      return exec::schedule_after(sched, 50ms) | ex::then([i] { return i; });
+    });
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> batches;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::iterate(std::views::iota(0, 3)) | exec::transform_each(slow)
+      | exec::batch(sched, 100, 5ms)
+      | exec::transform_each(ex::then(collect_batches{&mutex, &batches}))));
+    CHECK(result.has_value());
+    REQUIRE(batches.size() == 3);
+    CHECK(batches[0] == std::vector{0});
+    CHECK(batches[1] == std::vector{1});
+    CHECK(batches[2] == std::vector{2});
+  }
+
+  TEST_CASE("batch - forwards the first error", "[sequence_senders][batch]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    auto fail_on_three = ex::then([](int i) {
+      if (i == 3) {
+        throw std::runtime_error("three");
+      }
+      return i;
+    });
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> batches;
+    auto batched = exec::iterate(std::views::iota(0, 10)) | exec::transform_each(fail_on_three)
+                 | exec::batch(sched, 2, 10s)
+                 | exec::transform_each(ex::then(collect_batches{&mutex, &batches}));
+    CHECK_THROWS_AS(ex::sync_wait(exec::ignore_all_values(std::move(batched))), std::runtime_error);
+    REQUIRE(batches.size() == 1);
+    CHECK(batches[0] == std::vector{0, 1});
+  }
+
+  TEST_CASE(
+    "batch - the input may complete while the timer loop is running",
+    "[sequence_senders][batch]") {
+    exec::timed_thread_context ctx;
+    exec::static_thread_pool pool{1};
+
+    // The input completes on the pool while the timer is about to expire.
+    for (int i = 0; i < 200; ++i) {
+      std::mutex mutex;
+      std::vector<std::vector<int>> batches;
+      auto result = ex::sync_wait(exec::ignore_all_values(
+        exec::iterate(std::views::iota(0, 2))
+        | exec::transform_each(ex::continues_on(pool.get_scheduler()))
+        | exec::batch(ctx.get_scheduler(), 100, 20us)
+        | exec::transform_each(ex::then(collect_batches{&mutex, &batches}))));
+      CHECK(result.has_value());
+      std::size_t count = 0;
+      for (auto& batch: batches) {
+        count += batch.size();
+      }
+      CHECK(count == 2);
+    }
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+
+} // namespace
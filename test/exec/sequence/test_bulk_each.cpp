@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/bulk_each.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  auto make_block(int first) -> std::vector<int> {
+    std::vector<int> block(1000);
+    std::iota(block.begin(), block.end(), first);
+    return block;
+  }
+
+  // Schedules on a thread pool, records the address of every schedule
+  // operation that is started, and reports a parallelism of 2.
+  struct recording_scheduler {
+    using pool_scheduler = exec::static_thread_pool::scheduler;
+
+    struct started_ops {
+      std::mutex mutex;
+      std::set<const void*> addresses;
+    };
+
+    template <class Receiver>
+    struct operation {
+      operation(pool_scheduler sched, started_ops* started, Receiver rcvr)
+        : started_{started}
+        , op_{ex::connect(ex::schedule(sched), static_cast<Receiver&&>(rcvr))} {
+      }
+
+      void start() & noexcept {
+        {
+          std::scoped_lock lock{started_->mutex};
+          started_->addresses.insert(this);
+        }
+        ex::start(op_);
+      }
+
+      started_ops* started_;
+      ex::connect_result_t<ex::schedule_result_t<pool_scheduler>, Receiver> op_;
+    };
+
+    struct sender {
+      using sender_concept = ex::sender_t;
+      using completion_signatures =
+        ex::completion_signatures_of_t<ex::schedule_result_t<pool_scheduler>>;
+
+      template <class Receiver>
+      auto connect(Receiver rcvr) const -> operation<Receiver> {
+        return {sched_, started_, static_cast<Receiver&&>(rcvr)};
+      }
+
+      pool_scheduler sched_;
+      started_ops* started_;
+    };
+
+    [[nodiscard]]
+    auto schedule() const noexcept -> sender {
+      return {sched_, started_};
+    }
+
+    [[nodiscard]]
+    auto query(exec::get_available_parallelism_t) const noexcept -> std::size_t {
+      return 2;
+    }
+
+    auto operator==(const recording_scheduler&) const -> bool = default;
+
+    pool_scheduler sched_;
+    started_ops* started_;
+  };
+
+  TEST_CASE(
+    "bulk_each - runs the bulk function over the values of every item",
+    "[sequence_senders][bulk_each]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+
+    long sum = 0;
+    int count = 0;
+    auto blocks = exec::iterate(std::views::iota(0, 50))
+                | exec::transform_each(ex::then([](int i) { return make_block(i * 1000); }))
+                | exec::bulk_each(sched, std::size_t{1000}, [](std::size_t i, std::vector<int>& b) {
+                    b[i] *= 2;
+                  });
+    STATIC_REQUIRE(exec::sequence_sender<decltype(blocks)>);
+
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      blocks | exec::transform_each(ex::then([&](std::vector<int> block) {
+        sum += std::accumulate(block.begin(), block.end(), 0L);
+        ++count;
+      }))));
+    CHECK(result.has_value());
+    CHECK(count == 50);
+    CHECK(sum == 2 * (49'999L * 50'000 / 2));
+  }
+
+  TEST_CASE(
+    "bulk_each - sends the first exception once all agents are done",
+    "[sequence_senders][bulk_each]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+
+    std::atomic<int> calls{0};
+    auto blocks = exec::iterate(std::views::iota(0, 3))
+                | exec::bulk_each(sched, 64, [&](int i, int item) {
+                    ++calls;
+                    if (item == 1 && i == 10) {
+                      throw std::runtime_error("bulk_each");
+                    }
+                  });
+    CHECK_THROWS_AS(ex::sync_wait(exec::ignore_all_values(blocks)), std::runtime_error);
+    CHECK(calls > 64);
+  }
+
+  TEST_CASE(
+    "bulk_each - an empty shape passes the values through",
+    "[sequence_senders][bulk_each]") {
+    exec::static_thread_pool pool{2};
+    auto sched = pool.get_scheduler();
+
+    std::vector<int> received;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::iterate(std::views::iota(0, 4))
+      | exec::bulk_each(sched, 0, [](int, int) { FAIL("unexpected call"); })
+      | exec::transform_each(ex::then([&](int value) { received.push_back(value); }))));
+    CHECK(result.has_value());
+    CHECK(received == std::vector{0, 1, 2, 3});
+  }
+
+  TEST_CASE(
+    "bulk_each - reuses one crew for a sequence that emits its items one after another",
+    "[sequence_senders][bulk_each]") {
+    exec::static_thread_pool pool{4};
+    recording_scheduler::started_ops started;
+    recording_scheduler sched{pool.get_scheduler(), &started};
+
+    std::atomic<int> calls{0};
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::iterate(std::views::iota(0, 20))
+      | exec::bulk_each(sched, 64, [&](int, int) { ++calls; })));
+    CHECK(result.has_value());
+    CHECK(calls == 20 * 64);
+    // The two agents that the scheduler asks for, started in place for every
+    // item.
+    CHECK(started.addresses.size() == 2);
+  }
+
+  TEST_CASE(
+    "bulk_each - the agents see the stop token of the receiver of the item",
+    "[sequence_senders][bulk_each]") {
+    exec::static_thread_pool pool{2};
+    auto sched = pool.get_scheduler();
+
+    ex::inplace_stop_source stop_source;
+    std::atomic<int> late_calls{0};
+    auto blocks = exec::iterate(std::views::iota(0, 4)) | exec::transform_each(ex::then([&](int i) {
+                    if (i == 1) {
+                      stop_source.request_stop();
+                    }
+                    return i;
+                  }))
+                | exec::bulk_each(sched, 64, [&](int, int item) {
+                    if (item >= 1) {
+                      ++late_calls;
+                    }
+                  });
+    auto result = ex::sync_wait(
+      ex::write_env(
+        exec::ignore_all_values(blocks), ex::prop{ex::get_stop_token, stop_source.get_token()}));
+    CHECK_FALSE(result.has_value());
+    CHECK(late_calls == 0);
+  }
+
+#endif
+} // namespace
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/channel.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+  enum class completion {
+    none,
+    value,
+    stopped
+  };
+
+  struct flag_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value() noexcept {
+      *result_ = completion::value;
+    }
+
+    void set_stopped() noexcept {
+      *result_ = completion::stopped;
+    }
+
+    template <class _Error>
+    void set_error(_Error&&) noexcept {
+      FAIL_CHECK("set_error called on flag_receiver");
+    }
+
+    [[nodiscard]]
+    auto get_env() const noexcept {
+      return ex::prop{ex::get_stop_token, token_};
+    }
+
+    completion* result_;
+    ex::inplace_stop_token token_{};
+  };
+
+  template <class _Ty>
+  auto collect(std::vector<_Ty>& out) {
+    return exec::transform_each(ex::then([&out](_Ty value) { out.push_back(value); }));
+  }
+
+  TEST_CASE(
+    "channel - values are received in the order they were sent",
+    "[sequence_senders][channel]") {
+    exec::channel<int> ch{4};
+    STATIC_REQUIRE(exec::sequence_sender<decltype(ch.receive())>);
+    CHECK(ch.capacity() == 4);
+
+    for (int i = 0; i < 3; ++i) {
+      ex::sync_wait(ch.send(i));
+    }
+    ch.close();
+
+    std::vector<int> received;
+    auto result = ex::sync_wait(exec::ignore_all_values(ch.receive() | collect(received)));
+    CHECK(result.has_value());
+    CHECK(received == std::vector{0, 1, 2});
+  }
+
+  TEST_CASE("channel - send waits while the channel is full", "[sequence_senders][channel]") {
+    exec::channel<int> ch{1};
+    ex::sync_wait(ch.send(1));
+
+    completion sent = completion::none;
+    auto op = ex::connect(ch.send(2), flag_receiver{&sent});
+    ex::start(op);
+    CHECK(sent == completion::none);
+
+    completion closed = completion::none;
+    auto op2 = ex::connect(ch.send(3), flag_receiver{&closed});
+    ex::start(op2);
+
+    // Receiving the first value makes room for the second one.
+    std::vector<int> received;
+    auto first = exec::ignore_all_values(
+      ch.receive() | exec::transform_each(ex::let_value([&](int value) {
+        received.push_back(value);
+        return ex::just_stopped();
+      })));
+    ex::sync_wait(std::move(first));
+    CHECK(received == std::vector{1});
+    CHECK(sent == completion::value);
+    CHECK(closed == completion::none);
+
+    ch.close();
+    CHECK(closed == completion::stopped);
+    auto result = ex::sync_wait(exec::ignore_all_values(ch.receive() | collect(received)));
+    CHECK(result.has_value());
+    CHECK(received == std::vector{1, 2});
+  }
+
+  TEST_CASE("channel - waiting operations can be cancelled", "[sequence_senders][channel]") {
+    exec::channel<int> ch{0};
+
+    ex::inplace_stop_source send_stop;
+    completion sent = completion::none;
+    auto send_op = ex::connect(ch.send(1), flag_receiver{&sent, send_stop.get_token()});
+    ex::start(send_op);
+    CHECK(sent == completion::none);
+    send_stop.request_stop();
+    CHECK(sent == completion::stopped);
+
+    ex::inplace_stop_source receive_stop;
+    completion received = completion::none;
+    auto receive_op = ex::connect(
+      exec::ignore_all_values(ch.receive()), flag_receiver{&received, receive_stop.get_token()});
+    ex::start(receive_op);
+    CHECK(received == completion::none);
+    receive_stop.request_stop();
+    CHECK(received == completion::stopped);
+  }
+
+  TEST_CASE(
+    "channel - close completes a waiter only once when it races with cancellation",
+    "[sequence_senders][channel]") {
+    struct counting_receiver {
+      using receiver_concept = ex::receiver_t;
+
+      void set_value() noexcept {
+        complete();
+      }
+
+      void set_stopped() noexcept {
+        complete();
+      }
+
+      void complete() const noexcept {
+        ++*completions_;
+        // Lets a canceller on another thread run in the middle of close.
+        std::this_thread::yield();
+        if (stop_on_completion_ != nullptr) {
+          stop_on_completion_->request_stop();
+        }
+      }
+
+      [[nodiscard]]
+      auto get_env() const noexcept {
+        return ex::prop{ex::get_stop_token, token_};
+      }
+
+      std::atomic<int>* completions_;
+      ex::inplace_stop_token token_;
+      ex::inplace_stop_source* stop_on_completion_ = nullptr;
+    };
+
+    using send_sender_t = decltype(std::declval<exec::channel<int>&>().send(0));
+    using send_op_t = ex::connect_result_t<send_sender_t, counting_receiver>;
+
+    struct waiting_send {
+      waiting_send(exec::channel<int>& ch, counting_receiver rcvr)
+        : op_{ex::connect(ch.send(0), rcvr)} {
+      }
+
+      send_op_t op_;
+    };
+
+    constexpr int num_waiters = 16;
+
+    SECTION("cancelled while close completes the waiters before them") {
+      exec::channel<int> ch{0};
+      ex::inplace_stop_source stop;
+      std::vector<std::atomic<int>> completions(num_waiters);
+      std::vector<std::unique_ptr<waiting_send>> sends;
+      // Completing the first waiter cancels all the others, which close has
+      // not completed yet.
+      sends.push_back(std::make_unique<waiting_send>(
+        ch, counting_receiver{&completions[0], ex::inplace_stop_token{}, &stop}));
+      for (int i = 1; i < num_waiters; ++i) {
+        sends.push_back(
+          std::make_unique<waiting_send>(ch, counting_receiver{&completions[i], stop.get_token()}));
+      }
+      for (auto& send: sends) {
+        ex::start(send->op_);
+      }
+
+      ch.close();
+      for (auto& count: completions) {
+        CHECK(count == 1);
+      }
+    }
+
+    SECTION("cancelled from another thread") {
+      for (int iteration = 0; iteration < 200; ++iteration) {
+        exec::channel<int> ch{0};
+        std::vector<ex::inplace_stop_source> stops(num_waiters);
+        std::vector<std::atomic<int>> completions(num_waiters);
+        std::vector<std::unique_ptr<waiting_send>> sends;
+        for (int i = 0; i < num_waiters; ++i) {
+          sends.push_back(std::make_unique<waiting_send>(
+            ch, counting_receiver{&completions[i], stops[i].get_token()}));
+          ex::start(sends.back()->op_);
+        }
+
+        std::thread canceller{[&] {
+          for (auto& stop: stops) {
+            stop.request_stop();
+          }
+        }};
+        ch.close();
+        canceller.join();
+
+        for (auto& count: completions) {
+          CHECK(count == 1);
+        }
+      }
+    }
+  }
+
+  TEST_CASE(
+    "channel - connects producers and consumers on different threads",
+    "[sequence_senders][channel]") {
+    constexpr int num_values = 2000;
+    exec::static_thread_pool pool{2};
+    exec::channel<int> ch{8};
+
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+    auto consumer = [&] {
+      return ex::starts_on(
+        pool.get_scheduler(),
+        exec::ignore_all_values(ch.receive() | exec::transform_each(ex::then([&](int value) {
+                                  sum += value;
+                                  ++count;
+                                }))));
+    };
+
+    std::thread producer1{[&] {
+      for (int i = 0; i < num_values; i += 2) {
+        ex::sync_wait(ch.send(i));
+      }
+    }};
+    std::thread producer2{[&] {
+      for (int i = 1; i < num_values; i += 2) {
+        ex::sync_wait(ch.send(i));
+      }
+    }};
+    std::thread closer{[&] {
+      producer1.join();
+      producer2.join();
+      ch.close();
+    }};
+
+    auto result = ex::sync_wait(ex::when_all(consumer(), consumer()));
+    closer.join();
+    CHECK(result.has_value());
+    CHECK(count == num_values);
+    CHECK(sum == long{num_values} * (num_values - 1) / 2);
+  }
+} // namespace
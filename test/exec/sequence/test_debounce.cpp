@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/debounce.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+  using namespace std::chrono_literals;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  template <class _Sequence>
+  auto run(_Sequence&& sequence) -> std::vector<int> {
+    std::mutex mutex;
+    std::vector<int> values;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      static_cast<_Sequence&&>(sequence) | exec::transform_each(ex::then([&](int value) {
+        std::scoped_lock lock{mutex};
+        values.push_back(value);
+      }))));
+    CHECK(result.has_value());
+    return values;
+  }
+
+  TEST_CASE("debounce - emits the last value of a burst", "[sequence_senders][debounce]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    // The values 0, 1 and 2 form a burst, and so do 3 and 4.
+    auto delayed = ex::let_value([sched](int i) {
+      return exec::schedule_after(sched, i == 3 ? 300ms : 0ms) | ex::then([i] { return i; });
+    });
+    auto debounced = exec::iterate(std::views::iota(0, 5)) | exec::transform_each(delayed)
+                   | exec::debounce(sched, 100ms);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(debounced)>);
+
+    CHECK(run(std::move(debounced)) == std::vector{2, 4});
+  }
+
+  TEST_CASE(
+    "debounce - emits the pending value when the input completes",
+    "[sequence_senders][debounce]") {
+    exec::timed_thread_context ctx;
+    auto start = std::chrono::steady_clock::now();
+    auto values =
+      run(exec::iterate(std::views::iota(0, 5)) | exec::debounce(ctx.get_scheduler(), 10s));
+    CHECK(std::chrono::steady_clock::now() - start < 5s);
+    CHECK(values == std::vector{4});
+  }
+
+  TEST_CASE("debounce - forwards the first error", "[sequence_senders][debounce]") {
+    exec::timed_thread_context ctx;
+    auto fail_on_two = ex::then([](int i) {
+      if (i == 2) {
+        throw std::runtime_error("item failed");
+      }
+      return i;
+    });
+    auto debounced = exec::iterate(std::views::iota(0, 5)) | exec::transform_each(fail_on_two)
+                   | exec::debounce(ctx.get_scheduler(), 10s);
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(std::move(debounced))), std::runtime_error);
+  }
+
+  TEST_CASE(
+    "debounce - the input may complete while the timer loop is running",
+    "[sequence_senders][debounce]") {
+    exec::timed_thread_context ctx;
+    exec::static_thread_pool pool{1};
+
+    // The input completes on the pool while the timer is about to expire.
+    for (int i = 0; i < 200; ++i) {
+      auto values = run(
+        exec::iterate(std::views::iota(0, 2))
+        | exec::transform_each(ex::continues_on(pool.get_scheduler()))
+        | exec::debounce(ctx.get_scheduler(), 20us));
+      REQUIRE_FALSE(values.empty());
+      CHECK(values.back() == 1);
+    }
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+} // namespace
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/group_by.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/merge_each.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  using grouped_values = std::map<int, std::vector<int>>;
+
+  // Tags each value of a group with the key of the group.
+  struct tag_with_key {
+    template <class _Group>
+    auto operator()(_Group group) const {
+      return std::move(group)
+           | exec::transform_each(ex::then([key = group.key()](int value) {
+               return std::pair{key, value};
+             }));
+    }
+  };
+
+  struct collect {
+    void operator()(std::pair<int, int> tagged) const {
+      std::scoped_lock lock{*mutex_};
+      (*groups_)[tagged.first].push_back(tagged.second);
+    }
+
+    std::mutex* mutex_;
+    grouped_values* groups_;
+  };
+
+  TEST_CASE("group_by - splits a sequence by key", "[sequence_senders][group_by]") {
+    auto grouped = exec::iterate(std::views::iota(0, 10))
+                 | exec::group_by([](int value) { return value % 3; });
+    STATIC_REQUIRE(exec::sequence_sender<decltype(grouped)>);
+
+    std::mutex mutex;
+    grouped_values groups;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::merge_each(std::move(grouped) | exec::transform_each(ex::then(tag_with_key{})))
+      | exec::transform_each(ex::then(collect{&mutex, &groups}))));
+    CHECK(result.has_value());
+    REQUIRE(groups.size() == 3);
+    CHECK(groups[0] == std::vector{0, 3, 6, 9});
+    CHECK(groups[1] == std::vector{1, 4, 7});
+    CHECK(groups[2] == std::vector{2, 5, 8});
+  }
+
+  TEST_CASE(
+    "group_by - a stopped group drops the rest of its values",
+    "[sequence_senders][group_by]") {
+    std::mutex mutex;
+    grouped_values groups;
+    // The consumer of the odd values stops after the first one.
+    auto consume = [&](auto group) {
+      return tag_with_key{}(std::move(group))
+           | exec::transform_each(
+               ex::then([&](std::pair<int, int> tagged) {
+                 collect{&mutex, &groups}(tagged);
+                 if (tagged.first == 1) {
+                   throw std::runtime_error("odd");
+                 }
+               })
+               | ex::let_error([](auto&&) noexcept { return ex::just_stopped(); }));
+    };
+    ex::sync_wait(exec::ignore_all_values(exec::merge_each(
+      exec::iterate(std::views::iota(0, 10)) | exec::group_by([](int value) { return value % 2; })
+      | exec::transform_each(ex::then(consume)))));
+    CHECK(groups[0] == std::vector{0, 2, 4, 6, 8});
+    CHECK(groups[1] == std::vector{1});
+  }
+
+  TEST_CASE("group_by - forwards an error of the key function", "[sequence_senders][group_by]") {
+    auto key_fn = [](int value) {
+      if (value == 5) {
+        throw std::runtime_error("five");
+      }
+      return value % 2;
+    };
+
+    std::mutex mutex;
+    grouped_values groups;
+    auto grouped = exec::merge_each(
+                     exec::iterate(std::views::iota(0, 10)) | exec::group_by(key_fn)
+                     | exec::transform_each(ex::then(tag_with_key{})))
+                 | exec::transform_each(ex::then(collect{&mutex, &groups}));
+    CHECK_THROWS_AS(ex::sync_wait(exec::ignore_all_values(std::move(grouped))), std::runtime_error);
+    CHECK(groups[0] == std::vector{0, 2, 4});
+    CHECK(groups[1] == std::vector{1, 3});
+  }
+
+  TEST_CASE("group_by - groups are consumed on a thread pool", "[sequence_senders][group_by]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+
+    std::mutex mutex;
+    grouped_values groups;
+    auto on_pool = exec::transform_each(ex::let_value([sched](std::pair<int, int> tagged) {
+      return ex::schedule(sched) | ex::then([tagged] { return tagged; });
+    }));
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::merge_each(
+        exec::iterate(std::views::iota(0, 1000))
+        | exec::group_by([](int value) { return value % 7; })
+        | exec::transform_each(ex::then(tag_with_key{})))
+      | on_pool | exec::transform_each(ex::then(collect{&mutex, &groups}))));
+    CHECK(result.has_value());
+    REQUIRE(groups.size() == 7);
+    std::size_t count = 0;
+    for (auto& [key, values]: groups) {
+      count += values.size();
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        CHECK(values[i] == key + 7 * static_cast<int>(i));
+      }
+    }
+    CHECK(count == 1000);
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+
+} // namespace
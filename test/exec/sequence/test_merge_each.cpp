@@ -32,7 +32,13 @@
 #include <test_common/senders.hpp>
 #include <test_common/type_helpers.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace {
   using namespace std::chrono_literals;
@@ -343,6 +349,176 @@ namespace {
     CHECK(v.has_value() == true);
   }
 
+  // a sequence of sequences that fails with the provided error before it emits
+  // any nested sequence
+  template <class Error>
+  struct failing_sequence_t {
+    using range_sequence_t = STDEXEC::__call_result_t<decltype(range), int, int>;
+    using sender_concept = sequence_sender_t;
+    using item_types = exec::item_types<ex::__call_result_t<ex::just_t, range_sequence_t>>;
+    using completion_signatures =
+      ex::completion_signatures<ex::set_value_t(), ex::set_error_t(Error)>;
+
+    template <class Receiver>
+    struct operation {
+      void start() & noexcept {
+        ex::set_error(static_cast<Receiver&&>(receiver_), static_cast<Error&&>(error_));
+      }
+
+      Receiver receiver_;
+      Error error_;
+    };
+
+    template <class Receiver>
+    auto subscribe(Receiver receiver) && noexcept -> operation<Receiver> {
+      return {static_cast<Receiver&&>(receiver), static_cast<Error&&>(error_)};
+    }
+
+    Error error_;
+  };
+
+  TEST_CASE(
+    "merge_each - an error of the sequence of sequences is not replaced by the break",
+    "[sequence_senders][merge_each]") {
+    auto merged = merge_each(failing_sequence_t<std::runtime_error>{std::runtime_error{"outer"}});
+    CHECK_THROWS_AS(ex::sync_wait(ignore_all_values(std::move(merged))), std::runtime_error);
+  }
+
+  TEST_CASE(
+    "merge_each - an exception_ptr of the sequence of sequences is forwarded as is",
+    "[sequence_senders][merge_each]") {
+    auto merged = merge_each(failing_sequence_t<std::exception_ptr>{
+      std::make_exception_ptr(std::runtime_error{"outer"})});
+    CHECK_THROWS_AS(ex::sync_wait(ignore_all_values(std::move(merged))), std::runtime_error);
+  }
+
+  // holds back the first nested sequence that starts until it is opened, and
+  // records how deep the stack is when each nested sequence starts
+  struct sequence_gate {
+    bool open_ = false;
+    void* waiting_ = nullptr;
+    void (*complete_)(void*) noexcept = nullptr;
+    std::uintptr_t lowest_ = UINTPTR_MAX;
+    std::uintptr_t highest_ = 0;
+
+    void record_stack_depth() noexcept {
+      int local = 0;
+      auto address = reinterpret_cast<std::uintptr_t>(&local);
+      lowest_ = (std::min) (lowest_, address);
+      highest_ = (std::max) (highest_, address);
+    }
+
+    void open() noexcept {
+      open_ = true;
+      if (waiting_ != nullptr) {
+        complete_(std::exchange(waiting_, nullptr));
+      }
+    }
+  };
+
+  // a nested sequence of no items that completes inline once its gate is open
+  struct gated_sequence_t {
+    using sender_concept = sequence_sender_t;
+    using item_types = exec::item_types<>;
+    using completion_signatures = ex::completion_signatures<ex::set_value_t()>;
+
+    template <class Receiver>
+    struct operation {
+      void start() & noexcept {
+        gate_->record_stack_depth();
+        if (gate_->open_) {
+          ex::set_value(static_cast<Receiver&&>(receiver_));
+        } else {
+          gate_->waiting_ = this;
+          gate_->complete_ = [](void* self) noexcept {
+            ex::set_value(static_cast<Receiver&&>(static_cast<operation*>(self)->receiver_));
+          };
+        }
+      }
+
+      Receiver receiver_;
+      sequence_gate* gate_;
+    };
+
+    template <class Receiver>
+    auto subscribe(Receiver receiver) && noexcept -> operation<Receiver> {
+      return {static_cast<Receiver&&>(receiver), gate_};
+    }
+
+    sequence_gate* gate_;
+  };
+
+  // a sequence of sequences that emits all of its nested sequences at once,
+  // without waiting for their next-senders, and then opens the gate
+  struct fan_out_sequence_t {
+    using item_t = ex::__call_result_t<ex::just_t, gated_sequence_t>;
+    using sender_concept = sequence_sender_t;
+    using item_types = exec::item_types<item_t>;
+    using completion_signatures = ex::completion_signatures<ex::set_value_t()>;
+
+    template <class Receiver>
+    struct operation {
+      struct next_receiver {
+        using receiver_concept = ex::receiver_t;
+
+        void set_value() noexcept {
+          op_->item_complete();
+        }
+
+        void set_stopped() noexcept {
+          op_->item_complete();
+        }
+
+        operation* op_;
+      };
+
+      using next_op_t = ex::connect_result_t<next_sender_of_t<Receiver, item_t>, next_receiver>;
+
+      void item_complete() noexcept {
+        if (--remaining_ == 0) {
+          ex::set_value(static_cast<Receiver&&>(receiver_));
+        }
+      }
+
+      void start() & noexcept {
+        for (std::size_t i = 0; i < count_; ++i) {
+          next_ops_[i].__emplace_from([&] {
+            return ex::connect(
+              exec::set_next(receiver_, ex::just(gated_sequence_t{gate_})), next_receiver{this});
+          });
+          ex::start(next_ops_[i].value());
+        }
+        gate_->open();
+      }
+
+      Receiver receiver_;
+      sequence_gate* gate_;
+      std::size_t count_;
+      std::size_t remaining_{count_};
+      std::unique_ptr<ex::__optional<next_op_t>[]> next_ops_{new ex::__optional<next_op_t>[count_]};
+    };
+
+    template <class Receiver>
+    auto subscribe(Receiver receiver) && noexcept -> operation<Receiver> {
+      return {static_cast<Receiver&&>(receiver), gate_, count_};
+    }
+
+    sequence_gate* gate_;
+    std::size_t count_;
+  };
+
+  TEST_CASE(
+    "merge_each - queued nested sequences that complete inline do not grow the stack",
+    "[sequence_senders][merge_each]") {
+    sequence_gate gate;
+    auto merged = merge_each(fan_out_sequence_t{&gate, 10'000}, 1);
+    auto v = ex::sync_wait(ignore_all_values(std::move(merged)));
+    CHECK(v.has_value());
+    // Started one after the other from the same loop, every queued nested
+    // sequence starts at about the same depth.
+    CHECK(gate.highest_ - gate.lowest_ < 64 * 1024);
+  }
+
 // TODO - fix problem with stopping
 #  if 0
   TEST_CASE(
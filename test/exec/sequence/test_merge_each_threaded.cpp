@@ -32,8 +32,10 @@
 #include <test_common/senders.hpp>
 #include <test_common/type_helpers.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
+#include <set>
 #include <stdexcept>
 
 namespace {
@@ -365,6 +367,50 @@ namespace {
     CHECK(v.has_value() == false);
   }
 
+  TEST_CASE(
+    "merge_each - merge_each with max_concurrency bounds the running nested sequences",
+    "[sequence_senders][single_thread_context][merge_each][merge][iterate]") {
+
+    exec::single_thread_context ctx0;
+    ex::scheduler auto sched0 = ctx0.get_scheduler();
+    exec::timed_thread_context ctx1;
+    ex::scheduler auto sched1 = ctx1.get_scheduler();
+
+    auto nested = [sched1](int first) {
+      return range(first, first + 5) | delays_each_on(sched1, 1ms);
+    };
+
+    auto sequences = merge(
+      ex::just(nested(100)),
+      ex::just(nested(200)),
+      ex::just(nested(300)),
+      ex::just(nested(400)),
+      ex::just(nested(500)));
+
+    // a nested sequence is running from its first item to its last item
+    std::set<int> running;
+    std::size_t max_running = 0;
+    int count = 0;
+
+    auto v = ex::sync_wait(ignore_all_values(
+      merge_each(sequences, 2) | continues_each_on(sched0) // serializes output on the sched0 strand
+      | then_each([&](int x) {
+          ++count;
+          if (x % 100 == 0) {
+            running.insert(x / 100);
+          }
+          max_running = std::max(max_running, running.size());
+          if (x % 100 == 4) {
+            running.erase(x / 100);
+          }
+        })));
+
+    CHECK(v.has_value() == true);
+    CHECK(count == 25);
+    CHECK(max_running == 2);
+    CHECK(running.empty());
+  }
+
 #endif // STDEXEC_HAS_STD_RANGES()
 
 } // namespace
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/par_transform_each.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+  using namespace std::chrono_literals;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  TEST_CASE(
+    "par_transform_each - transforms every item on the scheduler",
+    "[sequence_senders][par_transform_each]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+    auto squares = exec::iterate(std::views::iota(0, 1000))
+                 | exec::par_transform_each(sched, 8, [](int i) { return long{i} * i; });
+    STATIC_REQUIRE(exec::sequence_sender<decltype(squares)>);
+
+    auto result = ex::sync_wait(
+      exec::ignore_all_values(squares | exec::transform_each(ex::then([&](long value) {
+                                sum += value;
+                                ++count;
+                              }))));
+    CHECK(result.has_value());
+    CHECK(count == 1000);
+    CHECK(sum == 999L * 1000 * 1999 / 6);
+  }
+
+  TEST_CASE(
+    "par_transform_each - preserves the input order on request",
+    "[sequence_senders][par_transform_each]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+
+    // Earlier items take longer, so they complete out of order.
+    auto delay = [](int i) {
+      std::this_thread::sleep_for(std::chrono::microseconds((16 - i % 16) * 50));
+      return i;
+    };
+
+    std::vector<int> received;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::iterate(std::views::iota(0, 64))
+      | exec::par_transform_each(sched, 8, delay, exec::item_order::preserved)
+      | exec::transform_each(ex::then([&](int value) { received.push_back(value); }))));
+    CHECK(result.has_value());
+    REQUIRE(received.size() == 64);
+    for (int i = 0; i < 64; ++i) {
+      CHECK(received[i] == i);
+    }
+  }
+
+  TEST_CASE(
+    "par_transform_each - bounds the number of items in flight",
+    "[sequence_senders][par_transform_each]") {
+    exec::static_thread_pool pool{8};
+    auto sched = pool.get_scheduler();
+
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    auto work = [&](int i) {
+      int now = ++running;
+      int prev = max_running.load();
+      while (prev < now && !max_running.compare_exchange_weak(prev, now)) {
+      }
+      std::this_thread::sleep_for(1ms);
+      --running;
+      return i;
+    };
+
+    std::atomic<int> count{0};
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      exec::iterate(std::views::iota(0, 50)) | exec::par_transform_each(sched, 3, work)
+      | exec::transform_each(ex::then([&](int) { ++count; }))));
+    CHECK(result.has_value());
+    CHECK(count == 50);
+    CHECK(max_running <= 3);
+  }
+
+  TEST_CASE(
+    "par_transform_each - forwards the first error",
+    "[sequence_senders][par_transform_each]") {
+    exec::static_thread_pool pool{2};
+    auto sched = pool.get_scheduler();
+
+    auto fail_on_five = [](int i) {
+      if (i == 5) {
+        throw std::runtime_error("five");
+      }
+      return i;
+    };
+
+    std::mutex mutex;
+    std::vector<int> received;
+    auto transformed = exec::iterate(std::views::iota(0, 100))
+                     | exec::par_transform_each(sched, 2, fail_on_five, exec::item_order::preserved)
+                     | exec::transform_each(ex::then([&](int value) {
+                         std::scoped_lock lock{mutex};
+                         received.push_back(value);
+                       }));
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(std::move(transformed))), std::runtime_error);
+    CHECK(received.size() <= 5);
+    for (std::size_t i = 0; i < received.size(); ++i) {
+      CHECK(received[i] == static_cast<int>(i));
+    }
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+
+} // namespace
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/throttle.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+  using namespace std::chrono_literals;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  template <class _Sequence>
+  auto run(_Sequence&& sequence) -> std::vector<int> {
+    std::vector<int> values;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      static_cast<_Sequence&&>(sequence)
+      | exec::transform_each(ex::then([&](int value) { values.push_back(value); }))));
+    CHECK(result.has_value());
+    return values;
+  }
+
+  TEST_CASE("throttle - paces the items of a sequence", "[sequence_senders][throttle]") {
+    exec::timed_thread_context ctx;
+    auto throttled =
+      exec::iterate(std::views::iota(0, 5)) | exec::throttle(ctx.get_scheduler(), 50ms);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(throttled)>);
+
+    auto start = std::chrono::steady_clock::now();
+    auto values = run(std::move(throttled));
+    CHECK(std::chrono::steady_clock::now() - start >= 200ms);
+    CHECK(values == std::vector{0, 1, 2, 3, 4});
+  }
+
+  TEST_CASE("throttle - lets a burst pass right away", "[sequence_senders][throttle]") {
+    exec::timed_thread_context ctx;
+    auto start = std::chrono::steady_clock::now();
+    auto values =
+      run(exec::iterate(std::views::iota(0, 4)) | exec::throttle(ctx.get_scheduler(), 10s, 4));
+    CHECK(std::chrono::steady_clock::now() - start < 5s);
+    CHECK(values == std::vector{0, 1, 2, 3});
+  }
+
+  TEST_CASE("throttle - waits for the tokens after a burst", "[sequence_senders][throttle]") {
+    exec::timed_thread_context ctx;
+    auto start = std::chrono::steady_clock::now();
+    auto values =
+      run(exec::iterate(std::views::iota(0, 6)) | exec::throttle(ctx.get_scheduler(), 100ms, 3));
+    CHECK(std::chrono::steady_clock::now() - start >= 300ms);
+    CHECK(values == std::vector{0, 1, 2, 3, 4, 5});
+  }
+
+  TEST_CASE("throttle - forwards the errors of the items", "[sequence_senders][throttle]") {
+    exec::timed_thread_context ctx;
+    auto fail_on_two = ex::then([](int i) {
+      if (i == 2) {
+        throw std::runtime_error("item failed");
+      }
+      return i;
+    });
+    auto throttled = exec::iterate(std::views::iota(0, 5)) | exec::transform_each(fail_on_two)
+                   | exec::throttle(ctx.get_scheduler(), 1ms);
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(std::move(throttled))), std::runtime_error);
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+} // namespace
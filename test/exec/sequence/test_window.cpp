@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/window.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+  using namespace std::chrono_literals;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  struct collect_windows {
+    auto operator()(std::vector<int> window) const {
+      std::scoped_lock lock{*mutex_};
+      windows_->push_back(std::move(window));
+    }
+
+    std::mutex* mutex_;
+    std::vector<std::vector<int>>* windows_;
+  };
+
+  template <class _Sequence>
+  auto run(_Sequence&& sequence) -> std::vector<std::vector<int>> {
+    std::mutex mutex;
+    std::vector<std::vector<int>> windows;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      static_cast<_Sequence&&>(sequence)
+      | exec::transform_each(ex::then(collect_windows{&mutex, &windows}))));
+    CHECK(result.has_value());
+    return windows;
+  }
+
+  TEST_CASE("window - tumbling windows by count", "[sequence_senders][window]") {
+    auto windowed = exec::iterate(std::views::iota(0, 10)) | exec::window(4);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(windowed)>);
+
+    auto windows = run(std::move(windowed));
+    REQUIRE(windows.size() == 3);
+    CHECK(windows[0] == std::vector{0, 1, 2, 3});
+    CHECK(windows[1] == std::vector{4, 5, 6, 7});
+    CHECK(windows[2] == std::vector{8, 9});
+  }
+
+  TEST_CASE("window - sliding and hopping windows by count", "[sequence_senders][window]") {
+    auto sliding = run(exec::iterate(std::views::iota(0, 5)) | exec::window(3, 1));
+    REQUIRE(sliding.size() == 3);
+    CHECK(sliding[0] == std::vector{0, 1, 2});
+    CHECK(sliding[1] == std::vector{1, 2, 3});
+    CHECK(sliding[2] == std::vector{2, 3, 4});
+
+    // A partial window is emitted only for values that have not been emitted.
+    auto overlapping = run(exec::iterate(std::views::iota(0, 4)) | exec::window(3, 2));
+    REQUIRE(overlapping.size() == 2);
+    CHECK(overlapping[0] == std::vector{0, 1, 2});
+    CHECK(overlapping[1] == std::vector{2, 3});
+
+    auto hopping = run(exec::iterate(std::views::iota(0, 10)) | exec::window(2, 3));
+    REQUIRE(hopping.size() == 4);
+    CHECK(hopping[0] == std::vector{0, 1});
+    CHECK(hopping[1] == std::vector{3, 4});
+    CHECK(hopping[2] == std::vector{6, 7});
+    CHECK(hopping[3] == std::vector{9});
+  }
+
+  TEST_CASE("window - forwards the first error", "[sequence_senders][window]") {
+    auto fail_on_three = ex::then([](int i) {
+      if (i == 3) {
+        throw std::runtime_error("three");
+      }
+      return i;
+    });
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> windows;
+    auto windowed = exec::iterate(std::views::iota(0, 10)) | exec::transform_each(fail_on_three)
+                  | exec::window(2)
+                  | exec::transform_each(ex::then(collect_windows{&mutex, &windows}));
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(std::move(windowed))), std::runtime_error);
+    REQUIRE(windows.size() == 1);
+    CHECK(windows[0] == std::vector{0, 1});
+  }
+
+  TEST_CASE("timed_window - tumbling windows by time", "[sequence_senders][window]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    // The third value arrives well after the first window has ended.
+    auto delayed = ex::let_value([sched](int i) {
+      return exec::schedule_after(sched, i == 2 ? 300ms : 0ms) | ex::then([i] { return i; });
+    });
+
+    auto windowed = exec::iterate(std::views::iota(0, 3)) | exec::transform_each(delayed)
+                  | exec::timed_window(sched, 100ms);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(windowed)>);
+
+    auto windows = run(std::move(windowed));
+    REQUIRE(windows.size() == 2);
+    CHECK(windows[0] == std::vector{0, 1});
+    CHECK(windows[1] == std::vector{2});
+  }
+
+  TEST_CASE(
+    "timed_window - emits the open window when the input completes",
+    "[sequence_senders][window]") {
+    exec::timed_thread_context ctx;
+    auto sched = ctx.get_scheduler();
+
+    auto start = std::chrono::steady_clock::now();
+    auto windows = run(exec::iterate(std::views::iota(0, 5)) | exec::timed_window(sched, 10s, 1s));
+    CHECK(std::chrono::steady_clock::now() - start < 5s);
+    REQUIRE(windows.size() == 1);
+    CHECK(windows[0] == std::vector{0, 1, 2, 3, 4});
+  }
+
+  TEST_CASE(
+    "timed_window - the input may complete while the timer loop is running",
+    "[sequence_senders][window]") {
+    exec::timed_thread_context ctx;
+    exec::static_thread_pool pool{1};
+
+    // The input completes on the pool while the window is about to end.
+    for (int i = 0; i < 200; ++i) {
+      auto windows = run(
+        exec::iterate(std::views::iota(0, 2))
+        | exec::transform_each(ex::continues_on(pool.get_scheduler()))
+        | exec::timed_window(ctx.get_scheduler(), 20us));
+      std::size_t count = 0;
+      for (auto& window: windows) {
+        count += window.size();
+      }
+      CHECK(count <= 2);
+    }
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+
+} // namespace
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/zip.hpp"
+
+#include "exec/sequence/channel.hpp"
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/iterate.hpp"
+#include "exec/sequence/transform_each.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+#if STDEXEC_HAS_STD_RANGES()
+
+  template <class _Tuple, class _Sequence>
+  auto run(_Sequence&& sequence) -> std::vector<_Tuple> {
+    std::vector<_Tuple> tuples;
+    auto result = ex::sync_wait(exec::ignore_all_values(
+      static_cast<_Sequence&&>(sequence)
+      | exec::transform_each(ex::then([&](_Tuple tuple) { tuples.push_back(tuple); }))));
+    CHECK(result.has_value());
+    return tuples;
+  }
+
+  TEST_CASE("zip - pairs up the items of its inputs", "[sequence_senders][zip]") {
+    auto letters = exec::iterate(std::views::iota(0, 3))
+                 | exec::transform_each(ex::then([](int i) { return static_cast<char>('a' + i); }));
+    auto zipped = exec::zip(exec::iterate(std::views::iota(0, 5)), std::move(letters));
+    STATIC_REQUIRE(exec::sequence_sender<decltype(zipped)>);
+
+    // The longer input is stopped once the shorter one has completed.
+    auto tuples = run<std::tuple<int, char>>(std::move(zipped));
+    CHECK(
+      tuples
+      == std::vector<std::tuple<int, char>>{
+        {0, 'a'},
+        {1, 'b'},
+        {2, 'c'}
+    });
+  }
+
+  TEST_CASE("zip - an empty input ends the sequence", "[sequence_senders][zip]") {
+    auto tuples = run<std::tuple<int, int>>(exec::zip(
+      exec::iterate(std::views::iota(0, 5)),
+      exec::iterate(std::views::iota(0, 0))));
+    CHECK(tuples.empty());
+  }
+
+  TEST_CASE("zip - forwards the error of an item", "[sequence_senders][zip]") {
+    auto failing = exec::iterate(std::views::iota(0, 5)) | exec::transform_each(ex::then([](int i) {
+                     if (i == 2) {
+                       throw std::runtime_error("item failed");
+                     }
+                     return i;
+                   }));
+    auto zipped = exec::zip(std::move(failing), exec::iterate(std::views::iota(0, 5)));
+    CHECK_THROWS_AS(ex::sync_wait(exec::ignore_all_values(std::move(zipped))), std::runtime_error);
+  }
+
+  TEST_CASE("zip - pairs up items that arrive on different threads", "[sequence_senders][zip]") {
+    constexpr int num_values = 2000;
+    exec::channel<int> first{4};
+    exec::channel<int> second{1};
+
+    auto produce = [](exec::channel<int>& ch) {
+      return std::thread{[&ch] {
+        for (int i = 0; i < num_values; ++i) {
+          ex::sync_wait(ch.send(i));
+        }
+        ch.close();
+      }};
+    };
+    std::thread producer1 = produce(first);
+    std::thread producer2 = produce(second);
+
+    auto tuples = run<std::tuple<int, int>>(exec::zip(first.receive(), second.receive()));
+    producer1.join();
+    producer2.join();
+    REQUIRE(tuples.size() == num_values);
+    for (int i = 0; i < num_values; ++i) {
+      CHECK(tuples[i] == std::tuple{i, i});
+    }
+  }
+
+  TEST_CASE(
+    "combine_latest - emits the latest values of its inputs",
+    "[sequence_senders][combine_latest]") {
+    auto combined = exec::combine_latest(
+      exec::iterate(std::views::iota(0, 3)), exec::iterate(std::views::iota(10, 13)));
+    STATIC_REQUIRE(exec::sequence_sender<decltype(combined)>);
+
+    // The first input has completed before the second one produces an item.
+    auto tuples = run<std::tuple<int, int>>(std::move(combined));
+    CHECK(
+      tuples
+      == std::vector<std::tuple<int, int>>{
+        { 2, 10},
+        { 2, 11},
+        { 2, 12}
+    });
+  }
+
+  TEST_CASE(
+    "combine_latest - follows the order in which items arrive",
+    "[sequence_senders][combine_latest]") {
+    exec::channel<int> first{4};
+    exec::channel<int> second{4};
+    ex::sync_wait(first.send(1));
+    ex::sync_wait(second.send(10));
+    ex::sync_wait(first.send(2));
+    first.close();
+    second.close();
+
+    auto tuples =
+      run<std::tuple<int, int>>(exec::combine_latest(first.receive(), second.receive()));
+    REQUIRE(!tuples.empty());
+    CHECK(tuples.back() == std::tuple{2, 10});
+  }
+
+  TEST_CASE(
+    "combine_latest - an input without items ends the sequence",
+    "[sequence_senders][combine_latest]") {
+    auto tuples = run<std::tuple<int, int>>(exec::combine_latest(
+      exec::iterate(std::views::iota(0, 3)),
+      exec::iterate(std::views::iota(0, 0))));
+    CHECK(tuples.empty());
+  }
+
+#endif // STDEXEC_HAS_STD_RANGES()
+} // namespace
@@ -21,11 +21,14 @@
 #include <exec/when_any.hpp>
 #include <stdexec/stop_token.hpp>
 
+#include <test_common/allocators.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/schedulers.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <array>
+
 using namespace STDEXEC;
 using namespace exec;
 
@@ -297,6 +300,58 @@ namespace {
   }
 #endif // !STDEXEC_NO_STD_EXCEPTIONS()
 
+  struct allocator_receiver {
+    using receiver_concept = STDEXEC::receiver_t;
+
+    void set_value(int value) noexcept {
+      *value_ = value;
+    }
+
+    [[nodiscard]]
+    auto get_env() const noexcept {
+      return prop{get_allocator, counting_allocator<std::byte>{count_}};
+    }
+
+    int* value_;
+    int* count_;
+  };
+
+  TEST_CASE(
+    "any_sender allocates large operation states with the receiver's allocator",
+    "[types][any_sender]") {
+    using sender_t = any_sender_of<set_value_t(int)>;
+    std::array<int, 32> big{};
+    big[0] = 42;
+    sender_t sndr = just(big) | then([](const std::array<int, 32>& a) noexcept { return a[0]; });
+    int value = 0;
+    int count = 0;
+    {
+      auto op = connect(std::move(sndr), allocator_receiver{&value, &count});
+      CHECK(count == 1);
+      start(op);
+      CHECK(value == 42);
+    }
+    CHECK(count == 0);
+  }
+
+  TEST_CASE("basic_any_sender stores operation states inline", "[types][any_sender]") {
+    using receiver_ref = any_receiver_ref<completion_signatures<set_value_t(int)>>;
+    using sender_t = receiver_ref::basic_any_sender<256, 256>;
+    static_assert(sizeof(sender_t) > 256);
+    std::array<int, 32> big{};
+    big[0] = 42;
+    sender_t sndr = just(big) | then([](const std::array<int, 32>& a) noexcept { return a[0]; });
+    int value = 0;
+    int count = 0;
+    {
+      auto op = connect(std::move(sndr), allocator_receiver{&value, &count});
+      CHECK(count == 0);
+      start(op);
+      CHECK(value == 42);
+    }
+    CHECK(count == 0);
+  }
+
   TEST_CASE("any_sender is connectable with any_receiver_ref", "[types][any_sender]") {
     using Sigs = completion_signatures<set_value_t(int), set_stopped_t()>;
     using receiver_ref = any_receiver_ref<Sigs>;
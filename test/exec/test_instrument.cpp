@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/instrument.hpp>
+#include <exec/static_thread_pool.hpp>
+
+#include <test_common/receivers.hpp>
+#include <test_common/type_helpers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace ex = STDEXEC;
+using namespace std::chrono_literals;
+
+namespace {
+
+  TEST_CASE("latency_histogram reports percentiles within bucket precision", "[instrument]") {
+    exec::latency_histogram hist;
+    CHECK(hist.count() == 0);
+    CHECK(hist.percentile(0.5) == 0);
+
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+      hist.record(i * 1000);
+    }
+    CHECK(hist.count() == 1000);
+    CHECK(hist.min() == 1000);
+    CHECK(hist.max() == 1'000'000);
+    CHECK(hist.mean() == Approx(500'500.0));
+    CHECK(hist.percentile(0.5) == Approx(500'000).epsilon(0.04));
+    CHECK(hist.percentile(0.99) == Approx(990'000).epsilon(0.04));
+    CHECK(hist.percentile(0.999) == Approx(999'000).epsilon(0.04));
+    CHECK(hist.percentile(1.0) == 1'000'000);
+
+    // Small values are exact.
+    exec::latency_histogram small;
+    small.record(3);
+    small.record(7);
+    CHECK(small.percentile(0.5) == 3);
+    CHECK(small.percentile(1.0) == 7);
+
+    // The largest values fall into the last row of buckets.
+    exec::latency_histogram large;
+    large.record(std::numeric_limits<std::uint64_t>::max());
+    large.record(std::uint64_t{1} << 63);
+    CHECK(large.count() == 2);
+    CHECK(large.max() == std::numeric_limits<std::uint64_t>::max());
+    CHECK(large.percentile(1.0) == std::numeric_limits<std::uint64_t>::max());
+
+    hist.reset();
+    CHECK(hist.count() == 0);
+    CHECK(hist.max() == 0);
+  }
+
+  TEST_CASE("instrument forwards completions and records one sample each", "[instrument]") {
+    exec::latency_recorder rec;
+    auto sndr = ex::just(42) | ex::then([](int i) { return i + 1; }) | exec::instrument(rec);
+    STATIC_REQUIRE(ex::sender<decltype(sndr)>);
+    check_val_types<ex::__mset<pack<int>>>(sndr);
+
+    auto [v] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(v == 43);
+    CHECK(rec.connect_to_start.count() == 1);
+    CHECK(rec.start_to_completion.count() == 1);
+    CHECK(rec.continuation_hop.count() == 0);
+
+    auto err = exec::instrument(ex::just_error(std::exception_ptr{}), rec);
+    auto op = ex::connect(std::move(err), expect_error_receiver{});
+    ex::start(op);
+    auto stopped = exec::instrument(ex::just_stopped(), rec);
+    auto op2 = ex::connect(std::move(stopped), expect_stopped_receiver{});
+    ex::start(op2);
+    CHECK(rec.start_to_completion.count() == 3);
+  }
+
+  TEST_CASE("instrument measures the duration of the wrapped stage", "[instrument]") {
+    exec::latency_recorder rec;
+    ex::sync_wait(
+      ex::just() | ex::then([] { std::this_thread::sleep_for(5ms); }) | exec::instrument(rec));
+    CHECK(rec.start_to_completion.min() >= 4'000'000);
+  }
+
+  TEST_CASE("an instrumented scheduler records continuation hops", "[instrument]") {
+    exec::static_thread_pool pool{2};
+    exec::latency_recorder rec;
+    auto sched = exec::instrument(pool.get_scheduler(), rec);
+    STATIC_REQUIRE(ex::scheduler<decltype(sched)>);
+    CHECK(sched == exec::instrument(pool.get_scheduler(), rec));
+    CHECK(
+      ex::get_forward_progress_guarantee(sched)
+      == ex::get_forward_progress_guarantee(pool.get_scheduler()));
+
+    auto sndr = ex::just(1) | ex::continues_on(sched) | ex::then([](int i) { return i * 2; })
+              | ex::bulk(ex::par, 4, [](int, int) { }) | exec::instrument(rec);
+    auto [v] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(v == 2);
+    CHECK(rec.continuation_hop.count() == 1);
+    CHECK(rec.start_to_completion.count() == 1);
+
+    ex::sync_wait(ex::starts_on(sched, ex::just()));
+    CHECK(rec.continuation_hop.count() == 2);
+  }
+} // namespace
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+// Some kernel versions have <linux/io_uring.h> but don't support or don't
+// allow user access to some of the necessary system calls.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0) && __has_include(<linux/io_uring.h>)
+
+#  define STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY 1
+
+#  include "exec/linux/io_uring_parallel_scheduler_backend.hpp"
+#  include "exec/system_context.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <atomic>
+#  include <cstddef>
+#  include <mutex>
+#  include <set>
+#  include <thread>
+#  include <vector>
+
+namespace ex = STDEXEC;
+namespace scr = ex::system_context_replaceability;
+using namespace std::chrono_literals;
+
+namespace {
+  struct recording_bulk_receiver : scr::bulk_item_receiver_proxy {
+    explicit recording_bulk_receiver(size_t size)
+      : counts_(size) {
+    }
+
+    void execute(size_t begin, size_t end) noexcept override {
+      std::lock_guard lock{mtx_};
+      threads_.insert(std::this_thread::get_id());
+      for (size_t i = begin; i < end; ++i) {
+        ++counts_[i];
+      }
+    }
+
+    void set_value() noexcept override {
+      done_.store(1);
+      done_.notify_all();
+    }
+
+    void set_error(std::exception_ptr&&) noexcept override {
+      done_.store(2);
+      done_.notify_all();
+    }
+
+    void set_stopped() noexcept override {
+      done_.store(3);
+      done_.notify_all();
+    }
+
+    auto wait() -> int {
+      done_.wait(0);
+      return done_.load();
+    }
+
+    [[nodiscard]]
+    auto all_executed_once() const -> bool {
+      return std::ranges::all_of(counts_, [](int c) { return c == 1; });
+    }
+
+    std::vector<int> counts_;
+    std::set<std::thread::id> threads_;
+    std::mutex mtx_;
+    std::atomic<int> done_{0};
+
+   protected:
+    void __query_env(ex::__type_index, ex::__type_index, void*) const noexcept override {
+    }
+  };
+
+  TEST_CASE(
+    "io_uring_parallel_scheduler_backend runs parallel scheduler work on its workers",
+    "[types][io_uring][system_scheduler]") {
+    static std::shared_ptr<exec::io_uring_parallel_scheduler_backend> backend;
+    backend = std::make_shared<exec::io_uring_parallel_scheduler_backend>(2);
+    auto old_factory = scr::set_parallel_scheduler_backend(
+      []() -> std::shared_ptr<scr::parallel_scheduler_backend> { return backend; });
+
+    std::thread::id this_id = std::this_thread::get_id();
+    auto [pool_id] = ex::sync_wait(ex::schedule(exec::get_parallel_scheduler()) | ex::then([] {
+                                     return std::this_thread::get_id();
+                                   }))
+                       .value();
+    CHECK(pool_id != this_id);
+
+    (void) scr::set_parallel_scheduler_backend(old_factory);
+    backend.reset();
+  }
+
+  TEST_CASE(
+    "io_uring_parallel_scheduler_backend completes I/O on the issuing worker",
+    "[types][io_uring][system_scheduler]") {
+    static std::shared_ptr<exec::io_uring_parallel_scheduler_backend> backend;
+    backend = std::make_shared<exec::io_uring_parallel_scheduler_backend>(2);
+    auto old_factory = scr::set_parallel_scheduler_backend(
+      []() -> std::shared_ptr<scr::parallel_scheduler_backend> { return backend; });
+
+    auto sndr = ex::schedule(exec::get_parallel_scheduler()) | ex::let_value([] {
+                  auto issuer = std::this_thread::get_id();
+                  return exec::schedule_after(backend->io_scheduler(), 1ms)
+                       | ex::then([issuer] { return issuer == std::this_thread::get_id(); });
+                });
+    auto [same_thread] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(same_thread);
+
+    (void) scr::set_parallel_scheduler_backend(old_factory);
+    backend.reset();
+  }
+
+  TEST_CASE(
+    "io_uring_parallel_scheduler_backend executes every bulk iteration exactly once",
+    "[types][io_uring][system_scheduler]") {
+    exec::io_uring_parallel_scheduler_backend backend{3};
+    CHECK(backend.available_parallelism() == 3);
+    {
+      recording_bulk_receiver rcvr{1000};
+      backend.schedule_bulk_chunked(1000, rcvr, {});
+      CHECK(rcvr.wait() == 1);
+      CHECK(rcvr.all_executed_once());
+    }
+    {
+      recording_bulk_receiver rcvr{100};
+      backend.schedule_bulk_unchunked(100, rcvr, {});
+      CHECK(rcvr.wait() == 1);
+      CHECK(rcvr.all_executed_once());
+      CHECK(rcvr.threads_.count(std::this_thread::get_id()) == 0);
+    }
+    {
+      // Large enough for the shared state and its tasks, which then skip the heap.
+      alignas(std::max_align_t) std::byte storage[1024];
+      recording_bulk_receiver rcvr{1000};
+      backend.schedule_bulk_chunked(1000, rcvr, storage);
+      CHECK(rcvr.wait() == 1);
+      CHECK(rcvr.all_executed_once());
+    }
+    {
+      recording_bulk_receiver rcvr{0};
+      backend.schedule_bulk_chunked(0, rcvr, {});
+      CHECK(rcvr.wait() == 1);
+    }
+  }
+} // namespace
+
+#endif
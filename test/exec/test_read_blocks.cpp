@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/read_blocks.hpp"
+
+#  include "exec/linux/io_uring_context.hpp"
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
+#  include "exec/static_thread_pool.hpp"
+
+#  include <catch2/catch.hpp>
+
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+
+#  include <algorithm>
+#  include <cerrno>
+#  include <cstddef>
+#  include <cstdlib>
+#  include <span>
+#  include <system_error>
+#  include <thread>
+#  include <vector>
+
+namespace {
+  namespace ex = STDEXEC;
+
+  // A temporary file with the given number of bytes of a known pattern.
+  class temporary_file {
+   public:
+    explicit temporary_file(std::size_t size) {
+      char path[] = "/tmp/stdexec_read_blocks_XXXXXX";
+      fd_ = ::mkstemp(path);
+      REQUIRE(fd_ >= 0);
+      ::unlink(path);
+      contents_.resize(size);
+      for (std::size_t i = 0; i < size; ++i) {
+        contents_[i] = static_cast<std::byte>(i * 7 % 251);
+      }
+      REQUIRE(::write(fd_, contents_.data(), size) == static_cast<::ssize_t>(size));
+    }
+
+    temporary_file(temporary_file&&) = delete;
+
+    ~temporary_file() {
+      ::close(fd_);
+    }
+
+    [[nodiscard]]
+    auto fd() const noexcept -> int {
+      return fd_;
+    }
+
+    [[nodiscard]]
+    auto contents() const noexcept -> const std::vector<std::byte>& {
+      return contents_;
+    }
+
+   private:
+    int fd_ = -1;
+    std::vector<std::byte> contents_;
+  };
+
+  template <class _Sequence>
+  auto read_all(_Sequence&& blocks) -> std::vector<std::vector<std::byte>> {
+    std::vector<std::vector<std::byte>> result;
+    auto copy = ex::then([&](std::span<const std::byte> block) {
+      result.emplace_back(block.begin(), block.end());
+    });
+    auto status = ex::sync_wait(
+      exec::ignore_all_values(static_cast<_Sequence&&>(blocks) | exec::transform_each(copy)));
+    CHECK(status.has_value());
+    return result;
+  }
+
+  auto concat(const std::vector<std::vector<std::byte>>& blocks) -> std::vector<std::byte> {
+    std::vector<std::byte> result;
+    for (auto& block: blocks) {
+      result.insert(result.end(), block.begin(), block.end());
+    }
+    return result;
+  }
+
+  TEST_CASE("read_blocks - reads a file block by block", "[sequence_senders][read_blocks]") {
+    temporary_file file{10000};
+    auto blocks = exec::read_blocks(file.fd(), 4096);
+    STATIC_REQUIRE(exec::sequence_sender<decltype(blocks)>);
+
+    auto result = read_all(std::move(blocks));
+    REQUIRE(result.size() == 3);
+    CHECK(result[0].size() == 4096);
+    CHECK(result[1].size() == 4096);
+    CHECK(result[2].size() == 10000 - 2 * 4096);
+    CHECK(concat(result) == file.contents());
+  }
+
+  TEST_CASE("read_blocks - an empty file has no blocks", "[sequence_senders][read_blocks]") {
+    temporary_file file{0};
+    CHECK(read_all(exec::read_blocks(file.fd(), 64)).empty());
+
+    // A file of whole blocks ends with an empty read.
+    temporary_file whole{128};
+    CHECK(read_all(exec::read_blocks(whole.fd(), 64)).size() == 2);
+  }
+
+  TEST_CASE("read_blocks - reads ahead on a thread pool", "[sequence_senders][read_blocks]") {
+    temporary_file file{100000};
+    exec::static_thread_pool pool{3};
+    auto result = read_all(exec::read_blocks(pool.get_scheduler(), file.fd(), 1000, 4));
+    CHECK(result.size() == 100);
+    CHECK(concat(result) == file.contents());
+  }
+
+  // Reads at most 100 bytes at a time, as a pipe or a network file system
+  // may.
+  struct short_read_scheduler : exec::static_thread_pool::scheduler {
+    [[nodiscard]]
+    auto read_at(int fd, std::span<std::byte> buffer, ::off_t offset) const {
+      return ex::then(ex::schedule(*this), [=] {
+        auto n = ::pread(fd, buffer.data(), (std::min) (buffer.size(), std::size_t{100}), offset);
+        if (n < 0) {
+          throw std::system_error(errno, std::system_category());
+        }
+        return static_cast<std::size_t>(n);
+      });
+    }
+  };
+
+  TEST_CASE("read_blocks - continues short reads", "[sequence_senders][read_blocks]") {
+    temporary_file file{100000};
+    exec::static_thread_pool pool{3};
+    for (int i = 0; i < 20; ++i) {
+      auto result =
+        read_all(exec::read_blocks(short_read_scheduler{pool.get_scheduler()}, file.fd(), 1000, 4));
+      CHECK(result.size() == 100);
+      CHECK(concat(result) == file.contents());
+    }
+  }
+
+  TEST_CASE("read_blocks - reads ahead with io_uring", "[sequence_senders][read_blocks]") {
+    temporary_file file{100000};
+    exec::io_uring_context context;
+    std::thread io_thread{[&] { context.run_until_stopped(); }};
+    auto result = read_all(exec::read_blocks(context.get_scheduler(), file.fd(), 4096, 8));
+    context.request_stop();
+    io_thread.join();
+    CHECK(result.size() == 25);
+    CHECK(concat(result) == file.contents());
+  }
+
+  TEST_CASE("read_blocks - forwards read errors", "[sequence_senders][read_blocks]") {
+    // Reading from a write-only descriptor fails with EBADF.
+    char path[] = "/tmp/stdexec_read_blocks_XXXXXX";
+    int fd = ::mkstemp(path);
+    REQUIRE(fd >= 0);
+    int write_only = ::open(path, O_WRONLY);
+    ::unlink(path);
+    ::close(fd);
+    REQUIRE(write_only >= 0);
+    CHECK_THROWS_AS(
+      ex::sync_wait(exec::ignore_all_values(exec::read_blocks(write_only, 64))),
+      std::system_error);
+    ::close(write_only);
+  }
+
+  TEST_CASE(
+    "read_blocks - yields the blocks of a mapped region",
+    "[sequence_senders][read_blocks]") {
+    temporary_file file{10000};
+    exec::memory_mapped_region region{
+      ::mmap(nullptr, 10000, PROT_READ, MAP_PRIVATE, file.fd(), 0), 10000};
+    REQUIRE(region);
+    auto result = read_all(exec::read_blocks(region, 4096));
+    REQUIRE(result.size() == 3);
+    CHECK(result[2].size() == 10000 - 2 * 4096);
+    CHECK(concat(result) == file.contents());
+  }
+} // namespace
+
+#endif
@@ -1,10 +1,16 @@
 #include "catch2/catch.hpp"
+#include <exec/sequence/ignore_all_values.hpp>
+#include <exec/sequence/transform_each.hpp>
 #include <exec/static_thread_pool.hpp>
 #include <stdexec/execution.hpp>
 
+#include <atomic>
 #include <mutex>
+#include <numeric>
+#include <ranges>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 namespace ex = STDEXEC;
 
 TEST_CASE(
@@ -57,3 +63,65 @@ TEST_CASE(
   ex::sync_wait(std::move(sender));
   REQUIRE(thread_ids.size() == num_of_threads);
 }
+
+#if STDEXEC_HAS_STD_RANGES()
+TEST_CASE("schedule_all emits every element of a range", "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{3};
+  std::vector<int> values(1000);
+  std::iota(values.begin(), values.end(), 1);
+
+  std::atomic<long> sum{0};
+  std::atomic<int> items{0};
+  auto sndr = exec::schedule_all(pool, std::views::all(values))
+            | exec::transform_each(ex::then([&](int value) {
+                sum += value;
+                ++items;
+              }))
+            | exec::ignore_all_values();
+  ex::sync_wait(std::move(sndr));
+  CHECK(items == 1000);
+  CHECK(sum == 500'500);
+}
+
+TEST_CASE(
+  "schedule_all_chunked emits contiguous chunks that cover the range",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{3};
+  std::vector<int> values(1000);
+  std::iota(values.begin(), values.end(), 1);
+
+  std::atomic<long> sum{0};
+  std::atomic<int> chunks{0};
+  std::atomic<int> short_chunks{0};
+  auto sndr = exec::schedule_all_chunked(pool, std::views::all(values), 64)
+            | exec::transform_each(ex::then([&](auto chunk) {
+                static_assert(std::ranges::contiguous_range<decltype(chunk)>);
+                for (int value: chunk) {
+                  sum += value;
+                }
+                if (chunk.size() != 64) {
+                  CHECK(chunk.size() == 1000 % 64);
+                  ++short_chunks;
+                }
+                ++chunks;
+              }))
+            | exec::ignore_all_values();
+  ex::sync_wait(std::move(sndr));
+  CHECK(chunks == 16);
+  CHECK(short_chunks == 1);
+  CHECK(sum == 500'500);
+
+  // A chunk size of 0 picks one based on the number of threads.
+  chunks = 0;
+  sum = 0;
+  ex::sync_wait(
+    exec::schedule_all_chunked(pool, std::views::all(values))
+    | exec::transform_each(ex::then([&](auto chunk) {
+        sum += std::accumulate(chunk.begin(), chunk.end(), 0L);
+        ++chunks;
+      }))
+    | exec::ignore_all_values());
+  CHECK(chunks == 12);
+  CHECK(sum == 500'500);
+}
+#endif
@@ -14,6 +14,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <thread>
 
 #define STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY 1
@@ -394,6 +400,85 @@ TEST_CASE(
   (void) scr::set_parallel_scheduler_backend(old_factory);
 }
 
+struct my_batching_backend_impl : my_parallel_scheduler_backend_impl {
+  void schedule_batch(std::span<scr::batch_entry> batch) noexcept override {
+    batch_sizes_.push_back(batch.size());
+    my_parallel_scheduler_backend_impl::base_t::schedule_batch(batch);
+  }
+
+  std::vector<size_t> batch_sizes_;
+};
+
+TEST_CASE(
+  "parallel_scheduler_batch submits work with one schedule_batch call",
+  "[types][system_scheduler]") {
+  static auto my_scheduler_backend = std::make_shared<my_batching_backend_impl>();
+  auto old_factory = scr::set_parallel_scheduler_backend(
+    []() -> std::shared_ptr<scr::parallel_scheduler_backend> { return my_scheduler_backend; });
+
+  constexpr int num_tasks = 100;
+  std::atomic<int> count = 0;
+  std::thread::id this_id = std::this_thread::get_id();
+  std::atomic<bool> ran_on_this_thread = false;
+  exec::parallel_scheduler sched = exec::get_parallel_scheduler();
+  exec::async_scope scope;
+  {
+    exec::parallel_scheduler_batch batch;
+    for (int i = 0; i < num_tasks; ++i) {
+      scope.spawn(ex::schedule(sched) | ex::then([&] {
+                    if (std::this_thread::get_id() == this_id) {
+                      ran_on_this_thread = true;
+                    }
+                    ++count;
+                  }));
+    }
+    REQUIRE(count.load() == 0);
+  }
+  ex::sync_wait(scope.on_empty());
+
+  REQUIRE(count.load() == num_tasks);
+  REQUIRE_FALSE(ran_on_this_thread.load());
+  REQUIRE(my_scheduler_backend->num_schedules() == 0);
+  REQUIRE(my_scheduler_backend->batch_sizes_ == std::vector<size_t>{num_tasks});
+
+  (void) scr::set_parallel_scheduler_backend(old_factory);
+}
+
+struct my_storage_recording_backend_impl : my_inline_scheduler_backend_impl {
+  void schedule(scr::receiver_proxy& r, std::span<std::byte> s) noexcept override {
+    storage_sizes_.push_back(s.size());
+    my_inline_scheduler_backend_impl::schedule(r, s);
+  }
+
+  std::vector<size_t> storage_sizes_;
+};
+
+TEST_CASE(
+  "schedule_batch falls back to schedule for backends that do not override it",
+  "[types][system_scheduler]") {
+  static auto my_scheduler_backend = std::make_shared<my_storage_recording_backend_impl>();
+  auto old_factory = scr::set_parallel_scheduler_backend(
+    []() -> std::shared_ptr<scr::parallel_scheduler_backend> { return my_scheduler_backend; });
+
+  int count = 0;
+  exec::parallel_scheduler sched = exec::get_parallel_scheduler();
+  {
+    exec::parallel_scheduler_batch batch;
+    ex::start_detached(ex::when_all(
+      ex::schedule(sched) | ex::then([&] { ++count; }),
+      ex::schedule(sched) | ex::then([&] { ++count; })));
+    REQUIRE(count == 0);
+    batch.flush();
+    REQUIRE(count == 2);
+  }
+  // Every operation is scheduled with its preallocated memory, as without a batch.
+  REQUIRE(
+    my_scheduler_backend->storage_sizes_
+    == std::vector<size_t>(2, STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE));
+
+  (void) scr::set_parallel_scheduler_backend(old_factory);
+}
+
 TEST_CASE("empty environment always returns nullopt for any query", "[types][system_scheduler]") {
   struct my_receiver : scr::receiver_proxy {
     void __query_env(ex::__type_index, ex::__type_index, void*) const noexcept override {
@@ -454,3 +539,168 @@ TEST_CASE("environment with a stop token can expose its stop token", "[types][sy
   REQUIRE(rcvr.try_query<int>(ex::get_stop_token) == std::nullopt);
   REQUIRE(rcvr.try_query<std::allocator<int>>(ex::get_allocator) == std::nullopt);
 }
+
+namespace {
+  // A bulk receiver that records which iterations were executed, and in how many chunks.
+  struct recording_bulk_receiver : scr::bulk_item_receiver_proxy {
+    explicit recording_bulk_receiver(size_t size, std::optional<size_t> chunk_size = {})
+      : counts(size)
+      , chunk_size(chunk_size) {
+    }
+
+    void execute(size_t begin, size_t end) noexcept override {
+      for (size_t i = begin; i < end; ++i) {
+        ++counts[i];
+      }
+      ++num_chunks;
+      size_t max = max_chunk.load();
+      while (max < end - begin && !max_chunk.compare_exchange_weak(max, end - begin)) {
+      }
+    }
+
+    // Notifies under the lock, so that the waiting thread, which may destroy the receiver once
+    // wait() returns, cannot return before the notification is done.
+    void set_value() noexcept override {
+      std::scoped_lock lock{mutex};
+      done = true;
+      done_cv.notify_one();
+    }
+
+    void set_error(std::exception_ptr&&) noexcept override {
+      FAIL("unexpected error");
+    }
+
+    void set_stopped() noexcept override {
+      FAIL("unexpected stop");
+    }
+
+    void wait() {
+      std::unique_lock lock{mutex};
+      done_cv.wait(lock, [this] { return done; });
+    }
+
+    [[nodiscard]]
+    auto all_executed_once() const -> bool {
+      return std::ranges::all_of(counts, [](const std::atomic<int>& c) { return c == 1; });
+    }
+
+   protected:
+    void __query_env(ex::__type_index query, ex::__type_index value, void* dest)
+      const noexcept override {
+      if (
+        chunk_size && query == ex::__mtypeid<scr::get_bulk_chunk_size_t>
+        && value == ex::__mtypeid<size_t>) {
+        *static_cast<std::optional<size_t>*>(dest) = chunk_size;
+      }
+    }
+
+   public:
+    std::vector<std::atomic<int>> counts;
+    std::optional<size_t> chunk_size;
+    std::atomic<size_t> num_chunks{0};
+    std::atomic<size_t> max_chunk{0};
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    bool done{false};
+  };
+} // namespace
+
+TEST_CASE(
+  "bulk_chunked in the default backend executes every iteration once with adaptive chunks",
+  "[types][system_scheduler]") {
+  constexpr size_t num_items = 1'000'000;
+  recording_bulk_receiver rcvr{num_items};
+  ex::__system_context_default_impl::__parallel_scheduler_backend_impl backend;
+  backend.schedule_bulk_chunked(num_items, rcvr, {});
+  rcvr.wait();
+
+  REQUIRE(rcvr.all_executed_once());
+}
+
+TEST_CASE(
+  "bulk_chunked in the default backend grows chunks for cheap iterations",
+  "[types][system_scheduler]") {
+  using namespace std::chrono_literals;
+  using ex::__system_context_default_impl::__next_bulk_chunk_size;
+  constexpr auto target = ex::__system_context_default_impl::__target_bulk_chunk_time;
+
+  // Chunks that are much faster than the target double, up to the maximum.
+  size_t chunk_size = 1;
+  int steps = 0;
+  while (chunk_size < 1000) {
+    chunk_size = __next_bulk_chunk_size(chunk_size, 1000, 10ns);
+    ++steps;
+  }
+  REQUIRE(chunk_size == 1000);
+  REQUIRE(steps == 10);
+  REQUIRE(__next_bulk_chunk_size(1000, 1000, 0ns) == 1000);
+
+  // Chunks close to the target keep their size, and much slower ones are halved, down to 1.
+  REQUIRE(__next_bulk_chunk_size(64, 1000, target) == 64);
+  REQUIRE(__next_bulk_chunk_size(64, 1000, target * 3) == 32);
+  REQUIRE(__next_bulk_chunk_size(1, 1000, target * 3) == 1);
+}
+
+TEST_CASE(
+  "bulk_chunked in the default backend uses the chunk size from the receiver",
+  "[types][system_scheduler]") {
+  constexpr size_t num_items = 1000;
+  recording_bulk_receiver rcvr{num_items, 7};
+  ex::__system_context_default_impl::__parallel_scheduler_backend_impl backend;
+  REQUIRE(rcvr.try_query<size_t>(scr::get_bulk_chunk_size) == 7);
+  backend.schedule_bulk_chunked(num_items, rcvr, {});
+  rcvr.wait();
+
+  REQUIRE(rcvr.all_executed_once());
+  REQUIRE(rcvr.max_chunk.load() == 7);
+  REQUIRE(rcvr.num_chunks.load() == (num_items + 6) / 7);
+}
+
+TEST_CASE(
+  "the default backend recycles operation states that do not fit the preallocated storage",
+  "[types][system_scheduler]") {
+  using op_t = std::array<std::byte, 200>;
+  ex::__system_context_default_impl::__recycling_allocator<op_t> alloc;
+  op_t* first = alloc.allocate(1);
+  alloc.deallocate(first, 1);
+  op_t* second = alloc.allocate(1);
+  REQUIRE(second == first);
+  alloc.deallocate(second, 1);
+
+  // Operations are still completed correctly when they are allocated.
+  recording_bulk_receiver rcvr{100};
+  ex::__system_context_default_impl::__parallel_scheduler_backend_impl backend;
+  std::byte small_storage[8];
+  backend.schedule_bulk_chunked(100, rcvr, small_storage);
+  rcvr.wait();
+  REQUIRE(rcvr.all_executed_once());
+}
+
+TEST_CASE(
+  "an operation state allocated during thread exit can be recycled by another thread",
+  "[types][system_scheduler]") {
+  using op_t = std::array<std::byte, 65>;
+  using big_op_t = std::array<std::byte, 100>;
+  // The thread_local below is destroyed after the thread's frame pool, which it outlives
+  // because it is constructed first.
+  static op_t* exiting_op = nullptr;
+  std::thread{[] {
+    struct at_exit {
+      ~at_exit() {
+        exiting_op = ex::__system_context_default_impl::__recycling_allocator<op_t>().allocate(1);
+      }
+    };
+    thread_local at_exit guard;
+    (void) exec::__frame::__frame_pool::__get();
+  }}.join();
+  REQUIRE(exiting_op != nullptr);
+
+  // Freed here, the block goes into the bucket for blocks of 65 to 128 bytes, from which a
+  // larger operation takes it. It must be as large as any block of that bucket.
+  ex::__system_context_default_impl::__recycling_allocator<op_t>().deallocate(exiting_op, 1);
+  ex::__system_context_default_impl::__recycling_allocator<big_op_t> alloc;
+  big_op_t* op = alloc.allocate(1);
+  CHECK(static_cast<void*>(op) == static_cast<void*>(exiting_op));
+  std::memset(op, 0, sizeof(big_op_t));
+  alloc.deallocate(op, 1);
+}
@@ -22,11 +22,15 @@
 #  include <exec/single_thread_context.hpp>
 #  include <exec/task.hpp>
 
+#  include <test_common/allocators.hpp>
 #  include <test_common/schedulers.hpp>
 
 #  include <catch2/catch.hpp>
 
+#  include <cstddef>
+#  include <cstring>
 #  include <string>
+#  include <thread>
 
 using namespace exec;
 using namespace STDEXEC;
@@ -304,6 +308,136 @@ namespace {
     CHECK(msg == "goodbye"s);
   }
 
+  auto add_with_allocator(std::allocator_arg_t, counting_allocator<int>, int a, int b)
+    -> task<int> {
+    co_return a + b;
+  }
+
+  struct adder {
+    auto add(std::allocator_arg_t, counting_allocator<int>, int b) const -> task<int> {
+      co_return a + b;
+    }
+
+    int a;
+  };
+
+  TEST_CASE("task - frame is allocated with the allocator argument", "[types][task]") {
+    int count = 0;
+    {
+      auto t = add_with_allocator(std::allocator_arg, counting_allocator<int>{&count}, 1, 2);
+      CHECK(count == 1);
+      auto [v] = sync_wait(std::move(t)).value();
+      CHECK(v == 3);
+    }
+    CHECK(count == 0);
+    {
+      adder self{40};
+      auto t = self.add(std::allocator_arg, counting_allocator<int>{&count}, 2);
+      CHECK(count == 1);
+      auto [v] = sync_wait(std::move(t)).value();
+      CHECK(v == 42);
+    }
+    CHECK(count == 0);
+  }
+
+  auto fib(int n) -> task<int> {
+    if (n < 2) {
+      co_return n;
+    }
+    co_return co_await fib(n - 1) + co_await fib(n - 2);
+  }
+
+  auto cached_frames() -> std::size_t {
+    return exec::__frame::__frame_pool::__get()->__cached();
+  }
+
+  auto cached_frames_in_frame() -> task<std::size_t> {
+    co_return cached_frames();
+  }
+
+  TEST_CASE("task - frames are recycled", "[types][task]") {
+    auto [v] = sync_wait(fib(15)).value();
+    CHECK(v == 610);
+    CHECK(cached_frames() > 0);
+
+    // The frame of the first call is cached when it completes, and the second call takes
+    // it from the pool instead of allocating a new one.
+    sync_wait(cached_frames_in_frame());
+    const std::size_t cached = cached_frames();
+    REQUIRE(cached > 0);
+    auto [in_frame] = sync_wait(cached_frames_in_frame()).value();
+    CHECK(in_frame == cached - 1);
+    CHECK(cached_frames() == cached);
+  }
+
+  TEST_CASE(
+    "task - a frame allocated during thread exit can be reused by another thread",
+    "[types][task]") {
+    // The thread_local below is destroyed after the thread's frame pool, which it
+    // outlives because it is constructed first.
+    static void* exiting_frame = nullptr;
+    std::thread{[] {
+      struct at_exit {
+        ~at_exit() {
+          exiting_frame = exec::__frame::__allocate_pooled(65);
+        }
+      };
+      thread_local at_exit guard;
+      (void) exec::__frame::__frame_pool::__get();
+    }}.join();
+    REQUIRE(exiting_frame != nullptr);
+
+    // Freed here, the frame goes into the bucket for frames of 65 to 128 bytes, from which
+    // a larger frame takes it. It must be as large as any frame of that bucket.
+    exec::__frame::__get_dealloc_fn(exiting_frame, 65)(exiting_frame, 65);
+    void* frame = exec::__frame::__allocate_pooled(100);
+    CHECK(frame == exiting_frame);
+    std::memset(frame, 0, 100);
+    exec::__frame::__get_dealloc_fn(frame, 100)(frame, 100);
+  }
+
+  // A sender that completes inline but does not advertise it.
+  struct sync_sender {
+    using sender_concept = sender_t;
+    using completion_signatures = STDEXEC::completion_signatures<set_value_t(int)>;
+
+    template <class Receiver>
+    struct operation {
+      void start() & noexcept {
+        STDEXEC::set_value(static_cast<Receiver&&>(rcvr_), 1);
+      }
+
+      Receiver rcvr_;
+    };
+
+    template <class Receiver>
+    auto connect(Receiver rcvr) const -> operation<Receiver> {
+      return {static_cast<Receiver&&>(rcvr)};
+    }
+  };
+
+  TEST_CASE("task - synchronous awaits do not grow the stack", "[types][task]") {
+    constexpr int iterations = 1'000'000;
+    auto inline_loop = []() -> task<int> {
+      int sum = 0;
+      for (int i = 0; i < iterations; ++i) {
+        sum += co_await just(1);
+      }
+      co_return sum;
+    };
+    auto sync_loop = []() -> task<int> {
+      int sum = 0;
+      for (int i = 0; i < iterations; ++i) {
+        sum += co_await sync_sender{};
+      }
+      co_return sum;
+    };
+    auto [v1] = sync_wait(inline_loop()).value();
+    CHECK(v1 == iterations);
+    auto [v2] = sync_wait(sync_loop()).value();
+    CHECK(v2 == iterations);
+  }
+
 #  if !STDEXEC_NO_STD_EXCEPTIONS()
   TEST_CASE("task - can error early", "[types][task]") {
     int count = 0;
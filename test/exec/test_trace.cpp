@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/static_thread_pool.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <exec/trace.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace ex = STDEXEC;
+using namespace std::chrono_literals;
+
+// Defined in test_trace_untraced.cpp, which is built without tracing.
+void run_untraced_pool();
+
+namespace {
+  auto count_of(const std::string& haystack, const std::string& needle) -> std::size_t {
+    std::size_t n = 0;
+    for (auto pos = haystack.find(needle); pos != std::string::npos;
+         pos = haystack.find(needle, pos + needle.size())) {
+      ++n;
+    }
+    return n;
+  }
+
+  TEST_CASE("static_thread_pool records enqueue and dequeue events", "[trace]") {
+    STATIC_REQUIRE(exec::trace::enabled);
+    exec::trace::clear();
+    {
+      exec::static_thread_pool pool{2};
+      for (int i = 0; i < 10; ++i) {
+        ex::sync_wait(ex::schedule(pool.get_scheduler()));
+      }
+    }
+    std::ostringstream out;
+    exec::trace::write_chrome_json(out);
+    auto json = out.str();
+    CHECK(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    CHECK(json.ends_with("]}\n"));
+    CHECK(count_of(json, "\"name\":\"enqueue\"") == 10);
+    CHECK(count_of(json, "\"name\":\"dequeue\"") == 10);
+    CHECK(count_of(json, "\"ph\":\"B\"") >= count_of(json, "\"ph\":\"E\""));
+  }
+
+  TEST_CASE("timed_thread_context records timer events", "[trace]") {
+    exec::trace::clear();
+    {
+      exec::timed_thread_context context;
+      ex::sync_wait(exec::schedule_after(context.get_scheduler(), 1ms));
+    }
+    std::ostringstream out;
+    exec::trace::write_chrome_json(out);
+    auto json = out.str();
+    CHECK(count_of(json, "\"name\":\"enqueue\"") >= 1);
+    CHECK(count_of(json, "\"name\":\"dequeue\"") == 1);
+    CHECK(count_of(json, "\"name\":\"parked\"") >= 2);
+
+    exec::trace::clear();
+    std::ostringstream empty;
+    exec::trace::write_chrome_json(empty);
+    CHECK(empty.str() == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+  }
+
+  TEST_CASE("threads hand their ring back when they exit", "[trace]") {
+    auto run_pool = [] {
+      exec::static_thread_pool pool{2};
+      ex::sync_wait(ex::schedule(pool.get_scheduler()));
+    };
+    run_pool();
+    auto& registry = exec::__trace::__registry::__instance();
+    auto rings = [&] {
+      std::scoped_lock lock{registry.__mutex_};
+      return registry.__rings_.size();
+    };
+    const auto before = rings();
+    for (int i = 0; i < 10; ++i) {
+      run_pool();
+    }
+    CHECK(rings() == before);
+  }
+
+  TEST_CASE("a translation unit built without tracing records no events", "[trace]") {
+    exec::trace::clear();
+    run_untraced_pool();
+    std::ostringstream out;
+    exec::trace::write_chrome_json(out);
+    CHECK(count_of(out.str(), "\"name\":\"enqueue\"") == 0);
+  }
+
+  TEST_CASE("the trace can be written while schedulers are running", "[trace]") {
+    exec::trace::clear();
+    std::atomic<bool> done{false};
+    std::thread producer{[&] {
+      exec::static_thread_pool pool{2};
+      for (int i = 0; i < 20'000; ++i) {
+        ex::sync_wait(ex::schedule(pool.get_scheduler()));
+      }
+      done.store(true);
+    }};
+    std::size_t dumps = 0;
+    bool well_formed = true;
+    do {
+      std::ostringstream out;
+      exec::trace::write_chrome_json(out);
+      auto json = out.str();
+      well_formed = well_formed
+                 && json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[")
+                 && json.ends_with("]}\n");
+      ++dumps;
+    } while (!done.load());
+    producer.join();
+    CHECK(dumps > 0);
+    CHECK(well_formed);
+  }
+} // namespace
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Built into the tracing test without tracing, to check that the two
+// settings can be linked into one program.
+#undef STDEXEC_ENABLE_TRACING
+#define STDEXEC_ENABLE_TRACING 0
+
+#include <exec/static_thread_pool.hpp>
+
+namespace ex = STDEXEC;
+
+void run_untraced_pool() {
+  exec::static_thread_pool pool{2};
+  for (int i = 0; i < 10; ++i) {
+    ex::sync_wait(ex::schedule(pool.get_scheduler()));
+  }
+}
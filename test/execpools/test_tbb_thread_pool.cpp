@@ -17,7 +17,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <span>
+#include <vector>
 
 #include <stdexec/execution.hpp>
 
@@ -167,4 +170,30 @@ namespace {
     REQUIRE(value.data() == output.data());
     CHECK(output == std::array{1.0, 3.0, 2.0, 0.0});
   }
+
+  TEST_CASE("tbb_thread_pool bulk_chunked runs every iteration once", "[tbb_thread_pool]") {
+    constexpr int n = 100'000;
+    std::vector<std::atomic<int>> counts(n);
+    execpools::tbb_thread_pool pool{2};
+    ex::sync_wait(
+      ex::schedule(pool.get_scheduler()) | ex::bulk_chunked(ex::par, n, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+          ++counts[static_cast<std::size_t>(i)];
+        }
+      }));
+    CHECK(std::ranges::all_of(counts, [](const std::atomic<int>& c) { return c == 1; }));
+  }
+
+#if !STDEXEC_NO_STD_EXCEPTIONS()
+  TEST_CASE("tbb_thread_pool bulk_chunked forwards exceptions", "[tbb_thread_pool]") {
+    execpools::tbb_thread_pool pool{2};
+    CHECK_THROWS(ex::sync_wait(
+      ex::schedule(pool.get_scheduler())
+      | ex::bulk_chunked(ex::par, 1000, [](int begin, int end) {
+          if (begin <= 500 && 500 < end) {
+            throw std::exception();
+          }
+        })));
+  }
+#endif // !STDEXEC_NO_STD_EXCEPTIONS()
 } // namespace
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+
+#include <stdexec/execution.hpp>
+
+#include <execpools/thread_pool_base.hpp>
+#include <test_common/type_helpers.hpp>
+
+namespace ex = STDEXEC;
+
+namespace {
+  // A pool that runs tasks inline, and whose parallel loop fails.
+  class failing_loop_pool : public execpools::thread_pool_base<failing_loop_pool> {
+   public:
+    [[nodiscard]]
+    auto available_parallelism() const -> std::uint32_t {
+      return 1;
+    }
+
+   private:
+    [[nodiscard]]
+    static constexpr auto forward_progress_guarantee() -> ex::forward_progress_guarantee {
+      return ex::forward_progress_guarantee::parallel;
+    }
+
+    friend execpools::thread_pool_base<failing_loop_pool>;
+
+    template <class PoolType, class Receiver>
+    friend struct execpools::operation;
+
+    void enqueue(execpools::task_base* task, std::uint32_t tid = 0) noexcept {
+      task->execute_(task, tid);
+    }
+
+    template <class Shape, class Fun>
+    void bulk_execute(Shape, Fun&&) {
+      throw std::runtime_error("bulk_execute");
+    }
+  };
+
+#if !STDEXEC_NO_STD_EXCEPTIONS()
+  TEST_CASE(
+    "thread_pool_base sends an exception of the pool's parallel loop as an error",
+    "[thread_pool_base]") {
+    failing_loop_pool pool;
+    auto sndr = ex::schedule(pool.get_scheduler())
+              | ex::bulk_chunked(ex::par, 10, [](int, int) noexcept { });
+    check_err_types<ex::__mset<std::exception_ptr>>(sndr);
+    CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+  }
+#endif // !STDEXEC_NO_STD_EXCEPTIONS()
+} // namespace
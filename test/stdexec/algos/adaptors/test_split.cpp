@@ -16,6 +16,7 @@
  */
 
 #include <catch2/catch.hpp>
+#include <exec/async_scope.hpp>
 #include <exec/static_thread_pool.hpp>
 #include <stdexec/execution.hpp>
 #include <test_common/receivers.hpp>
@@ -23,6 +24,9 @@
 #include <test_common/senders.hpp>
 #include <test_common/type_helpers.hpp>
 
+#include <atomic>
+#include <vector>
+
 namespace ex = STDEXEC;
 
 using namespace std::chrono_literals;
@@ -483,6 +487,33 @@ namespace {
     (void) snd;
   }
 
+  TEST_CASE(
+    "split completes every waiter exactly once when stop races with start",
+    "[adaptors][split]") {
+    exec::static_thread_pool pool{4};
+    auto sch = pool.get_scheduler();
+    constexpr int waiters = 16;
+    std::atomic<int> values{0};
+    std::atomic<int> stops{0};
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+      auto snd = ex::split(ex::schedule(sch) | ex::then([] { return 42; }));
+      std::vector<ex::inplace_stop_source> sources(waiters);
+      exec::async_scope scope;
+      for (int i = 0; i < waiters; ++i) {
+        scope.spawn(
+          ex::starts_on(sch, snd | ex::then([&](int v) { values += v == 42; }))
+          | ex::upon_stopped([&] { ++stops; })
+          | ex::write_env(ex::prop{ex::get_stop_token, sources[i].get_token()}));
+      }
+      for (int i = 0; i < waiters; i += 2) {
+        scope.spawn(ex::schedule(sch) | ex::then([&sources, i] { sources[i].request_stop(); }));
+      }
+      ex::sync_wait(scope.on_empty());
+    }
+    CHECK(values + stops == 500 * waiters);
+  }
+
   struct my_sender {
     using sender_concept = ex::sender_t;
     using is_sender = void;
@@ -15,8 +15,11 @@
  */
 
 #include <catch2/catch.hpp>
+#include <stdexec/__detail/__completion_behavior.hpp>
 #include <stdexec/__detail/__meta.hpp>
+#include <stdexec/__detail/__utility.hpp>
 
+#include <cstdint>
 #include <optional>
 
 using namespace std;
@@ -56,4 +59,27 @@ namespace {
     using res = __minvoke<tr, int, char>;
     static_assert(is_same_v<res, tuple<optional<int>, optional<char>>>);
   }
+
+  TEST_CASE("__umin returns the smallest of its arguments", "[detail][umin]") {
+    STATIC_REQUIRE(__umin({}) == 0);
+    STATIC_REQUIRE(__umin({7}) == 7);
+    STATIC_REQUIRE(__umin({3, 1, 2}) == 1);
+    STATIC_REQUIRE(__umin({4, 5, 6}) == 4);
+    STATIC_REQUIRE(__umin({SIZE_MAX, 9}) == 9);
+  }
+
+  TEST_CASE(
+    "completion_behavior::weakest returns the weakest of the behaviors",
+    "[detail][umin]") {
+    constexpr auto weakest = completion_behavior::weakest;
+    STATIC_REQUIRE(
+      weakest(completion_behavior::inline_completion, completion_behavior::inline_completion)
+      == completion_behavior::inline_completion);
+    STATIC_REQUIRE(
+      weakest(completion_behavior::inline_completion, completion_behavior::asynchronous_affine)
+      == completion_behavior::asynchronous_affine);
+    STATIC_REQUIRE(
+      weakest(completion_behavior::asynchronous, completion_behavior::inline_completion)
+      == completion_behavior::asynchronous);
+  }
 } // namespace
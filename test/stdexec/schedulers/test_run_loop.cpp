@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <catch2/catch.hpp>
+#include <stdexec/execution.hpp>
+#include <test_common/receivers.hpp>
+
+#include <chrono>
+#include <thread>
+
+namespace ex = STDEXEC;
+
+using namespace std::chrono_literals;
+
+namespace {
+  TEST_CASE("run_loop::poll executes ready tasks without blocking", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    CHECK(loop.poll() == 0);
+
+    int count = 0;
+    auto sndr = ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; });
+    auto op1 = ex::connect(sndr, expect_void_receiver{});
+    auto op2 = ex::connect(sndr, expect_void_receiver{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(count == 0);
+    CHECK(loop.poll() == 2);
+    CHECK(count == 2);
+    CHECK(loop.poll() == 0);
+    loop.finish();
+    loop.run();
+  }
+
+  TEST_CASE("run_loop::run_one executes one task at a time", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    int count = 0;
+    auto sndr = ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; });
+    auto op1 = ex::connect(sndr, expect_void_receiver{});
+    auto op2 = ex::connect(sndr, expect_void_receiver{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(loop.run_one() == 1);
+    CHECK(count == 1);
+    CHECK(loop.run_one() == 1);
+    CHECK(count == 2);
+    loop.finish();
+    CHECK(loop.run_one() == 0);
+    loop.run();
+  }
+
+  TEST_CASE("run_loop::run executes the tasks left over by run_one", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    int count = 0;
+    auto op1 = ex::connect(
+      ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; }), expect_void_receiver{});
+    auto op2 = ex::connect(
+      ex::schedule(loop.get_scheduler()) | ex::then([&] {
+        ++count;
+        loop.finish();
+      }),
+      expect_void_receiver{});
+    ex::start(op1);
+    ex::start(op2);
+    CHECK(loop.run_one() == 1);
+    CHECK(count == 1);
+    // The second task has been dequeued by run_one, so run() must not block on the queue.
+    loop.run();
+    CHECK(count == 2);
+  }
+
+  TEST_CASE("run_loop::run_one blocks until work arrives", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    loop.set_spin_count(1000);
+    bool done = false;
+    auto op = ex::connect(
+      ex::schedule(loop.get_scheduler()) | ex::then([&] { done = true; }), expect_void_receiver{});
+    std::thread producer{[&] {
+      std::this_thread::sleep_for(10ms);
+      ex::start(op);
+    }};
+    CHECK(loop.run_one() == 1);
+    CHECK(done);
+    producer.join();
+    loop.finish();
+    loop.run();
+  }
+
+  TEST_CASE("run_loop::run_for executes work until the deadline", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    CHECK(loop.run_for(1ms) == 0);
+
+    int count = 0;
+    auto op = ex::connect(
+      ex::schedule(loop.get_scheduler()) | ex::then([&] { ++count; }), expect_void_receiver{});
+    ex::start(op);
+    CHECK(loop.run_for(1ms) == 1);
+    CHECK(count == 1);
+
+    // Returns early once the loop is finished and drained:
+    loop.finish();
+    auto start = std::chrono::steady_clock::now();
+    CHECK(loop.run_for(10s) == 0);
+    CHECK(std::chrono::steady_clock::now() - start < 10s);
+  }
+
+  TEST_CASE("sync_wait works with a spinning run_loop", "[scheduler][run_loop]") {
+    ex::run_loop loop;
+    loop.set_spin_count(100);
+    std::thread driver{[&] { loop.run(); }};
+    auto [v] = ex::sync_wait(ex::starts_on(loop.get_scheduler(), ex::just(42))).value();
+    CHECK(v == 42);
+    loop.finish();
+    driver.join();
+  }
+} // namespace
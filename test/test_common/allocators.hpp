@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace {
+
+  // An allocator that counts the allocations that are alive in *count.
+  template <class T>
+  struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(int* count) noexcept
+      : count_{count} {
+    }
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept
+      : count_{other.count_} {
+    }
+
+    auto allocate(std::size_t n) -> T* {
+      ++*count_;
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      --*count_;
+      std::allocator<T>{}.deallocate(p, n);
+    }
+
+    auto operator==(const counting_allocator&) const noexcept -> bool = default;
+
+    int* count_;
+  };
+
+} // namespace